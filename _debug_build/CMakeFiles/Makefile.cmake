@@ -0,0 +1,331 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/contrib/CMakeLists.txt"
+  "/root/repo/contrib/hiredis/CMakeLists.txt"
+  "/root/repo/contrib/thrift/CMakeLists.txt"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/ace/logging/CMakeLists.txt"
+  "/root/repo/examples/ace/ttcp/CMakeLists.txt"
+  "/root/repo/examples/asio/chat/CMakeLists.txt"
+  "/root/repo/examples/asio/tutorial/CMakeLists.txt"
+  "/root/repo/examples/cdns/CMakeLists.txt"
+  "/root/repo/examples/curl/CMakeLists.txt"
+  "/root/repo/examples/fastcgi/CMakeLists.txt"
+  "/root/repo/examples/filetransfer/CMakeLists.txt"
+  "/root/repo/examples/hub/CMakeLists.txt"
+  "/root/repo/examples/idleconnection/CMakeLists.txt"
+  "/root/repo/examples/maxconnection/CMakeLists.txt"
+  "/root/repo/examples/memcached/client/CMakeLists.txt"
+  "/root/repo/examples/memcached/server/CMakeLists.txt"
+  "/root/repo/examples/multiplexer/CMakeLists.txt"
+  "/root/repo/examples/netty/discard/CMakeLists.txt"
+  "/root/repo/examples/netty/echo/CMakeLists.txt"
+  "/root/repo/examples/netty/uptime/CMakeLists.txt"
+  "/root/repo/examples/pingpong/CMakeLists.txt"
+  "/root/repo/examples/procmon/CMakeLists.txt"
+  "/root/repo/examples/protobuf/CMakeLists.txt"
+  "/root/repo/examples/protobuf/codec/CMakeLists.txt"
+  "/root/repo/examples/protobuf/resolver/CMakeLists.txt"
+  "/root/repo/examples/protobuf/rpc/CMakeLists.txt"
+  "/root/repo/examples/protobuf/rpcbalancer/CMakeLists.txt"
+  "/root/repo/examples/protobuf/rpcbench/CMakeLists.txt"
+  "/root/repo/examples/roundtrip/CMakeLists.txt"
+  "/root/repo/examples/shorturl/CMakeLists.txt"
+  "/root/repo/examples/simple/CMakeLists.txt"
+  "/root/repo/examples/socks4a/CMakeLists.txt"
+  "/root/repo/examples/sudoku/CMakeLists.txt"
+  "/root/repo/examples/twisted/finger/CMakeLists.txt"
+  "/root/repo/examples/wordcount/CMakeLists.txt"
+  "/root/repo/examples/zeromq/CMakeLists.txt"
+  "/root/repo/muduo/base/CMakeLists.txt"
+  "/root/repo/muduo/base/tests/CMakeLists.txt"
+  "/root/repo/muduo/net/CMakeLists.txt"
+  "/root/repo/muduo/net/http/CMakeLists.txt"
+  "/root/repo/muduo/net/inspect/CMakeLists.txt"
+  "/root/repo/muduo/net/protobuf/CMakeLists.txt"
+  "/root/repo/muduo/net/protorpc/CMakeLists.txt"
+  "/root/repo/muduo/net/tests/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindProtobuf.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/base/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/net/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/net/http/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/net/inspect/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/net/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/net/protobuf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "muduo/net/protorpc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/hiredis/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "contrib/thrift/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/ace/ttcp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/asio/chat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/asio/tutorial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/fastcgi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/filetransfer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/hub/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/idleconnection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/maxconnection/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/memcached/client/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/memcached/server/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/multiplexer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/netty/discard/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/netty/echo/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/netty/uptime/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/pingpong/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/roundtrip/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/shorturl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/simple/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/socks4a/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/sudoku/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/twisted/finger/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/wordcount/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/zeromq/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/cdns/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/curl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/ace/logging/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/protobuf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/protobuf/codec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/protobuf/rpc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/protobuf/rpcbalancer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/protobuf/rpcbench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/protobuf/resolver/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/procmon/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/asynclogging_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/atomic_unittest.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/blockingqueue_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/blockingqueue_bench.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/blockingqueue_bench2.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/boundedblockingqueue_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/date_unittest.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/exception_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/fileutil_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/fork_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/gzipfile_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/logfile_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/logging_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/logstream_bench.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/logstream_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/mutex_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/processinfo_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/singleton_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/singleton_threadlocal_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/threadaffinity_unittest.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/thread_bench.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/thread_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/threadlocal_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/threadlocalsingleton_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/threadpool_test.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/timestamp_unittest.dir/DependInfo.cmake"
+  "muduo/base/tests/CMakeFiles/timezone_unittest.dir/DependInfo.cmake"
+  "muduo/net/CMakeFiles/muduo_net.dir/DependInfo.cmake"
+  "muduo/net/http/CMakeFiles/muduo_http.dir/DependInfo.cmake"
+  "muduo/net/http/CMakeFiles/httpserver_test.dir/DependInfo.cmake"
+  "muduo/net/http/CMakeFiles/httprequest_bench.dir/DependInfo.cmake"
+  "muduo/net/http/CMakeFiles/httprequest_unittest.dir/DependInfo.cmake"
+  "muduo/net/http/CMakeFiles/httpresponse_unittest.dir/DependInfo.cmake"
+  "muduo/net/http/CMakeFiles/httpserver_unittest.dir/DependInfo.cmake"
+  "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/DependInfo.cmake"
+  "muduo/net/inspect/CMakeFiles/inspector_test.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/acceptor_bench.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/channel_test.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/echoserver_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/echoclient_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/eventloop_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/eventloop_bench.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/eventloopthread_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/eventloopthreadpool_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/buffer_bench.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/buffer_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/bufferchain_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/bufferpool_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/timingwheel_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/inetaddress_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/udpsocket_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/tcpconnection_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/zlibstream_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/tcpclient_reg1.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/tcpclient_reg2.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/tcpclient_reg3.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/timerqueue_unittest.dir/DependInfo.cmake"
+  "muduo/net/tests/CMakeFiles/timerqueue_bench.dir/DependInfo.cmake"
+  "muduo/net/protobuf/CMakeFiles/muduo_protobuf_codec.dir/DependInfo.cmake"
+  "muduo/net/protorpc/CMakeFiles/muduo_protorpc_wire.dir/DependInfo.cmake"
+  "muduo/net/protorpc/CMakeFiles/protobuf_rpc_wire_test.dir/DependInfo.cmake"
+  "muduo/net/protorpc/CMakeFiles/muduo_protorpc.dir/DependInfo.cmake"
+  "muduo/net/protorpc/CMakeFiles/protobuf_rpc_calltable_test.dir/DependInfo.cmake"
+  "muduo/net/protorpc/CMakeFiles/protobuf_rpc_channel_test.dir/DependInfo.cmake"
+  "contrib/hiredis/CMakeFiles/mrediscli.dir/DependInfo.cmake"
+  "contrib/thrift/CMakeFiles/muduo_thrift.dir/DependInfo.cmake"
+  "examples/ace/ttcp/CMakeFiles/ttcp_blocking.dir/DependInfo.cmake"
+  "examples/ace/ttcp/CMakeFiles/ttcp_muduo.dir/DependInfo.cmake"
+  "examples/ace/ttcp/CMakeFiles/ttcp_asio_sync.dir/DependInfo.cmake"
+  "examples/ace/ttcp/CMakeFiles/ttcp_asio_async.dir/DependInfo.cmake"
+  "examples/asio/chat/CMakeFiles/asio_chat_client.dir/DependInfo.cmake"
+  "examples/asio/chat/CMakeFiles/asio_chat_loadtest.dir/DependInfo.cmake"
+  "examples/asio/chat/CMakeFiles/asio_chat_server.dir/DependInfo.cmake"
+  "examples/asio/chat/CMakeFiles/asio_chat_server_threaded.dir/DependInfo.cmake"
+  "examples/asio/chat/CMakeFiles/asio_chat_server_threaded_efficient.dir/DependInfo.cmake"
+  "examples/asio/chat/CMakeFiles/asio_chat_server_threaded_highperformance.dir/DependInfo.cmake"
+  "examples/asio/tutorial/CMakeFiles/asio_tutorial_timer2.dir/DependInfo.cmake"
+  "examples/asio/tutorial/CMakeFiles/asio_tutorial_timer3.dir/DependInfo.cmake"
+  "examples/asio/tutorial/CMakeFiles/asio_tutorial_timer4.dir/DependInfo.cmake"
+  "examples/asio/tutorial/CMakeFiles/asio_tutorial_timer5.dir/DependInfo.cmake"
+  "examples/asio/tutorial/CMakeFiles/asio_tutorial_timer6.dir/DependInfo.cmake"
+  "examples/fastcgi/CMakeFiles/fastcgi_test.dir/DependInfo.cmake"
+  "examples/filetransfer/CMakeFiles/filetransfer_download.dir/DependInfo.cmake"
+  "examples/filetransfer/CMakeFiles/filetransfer_download2.dir/DependInfo.cmake"
+  "examples/filetransfer/CMakeFiles/filetransfer_download3.dir/DependInfo.cmake"
+  "examples/filetransfer/CMakeFiles/filetransfer_download4.dir/DependInfo.cmake"
+  "examples/hub/CMakeFiles/hub.dir/DependInfo.cmake"
+  "examples/hub/CMakeFiles/muduo_pubsub.dir/DependInfo.cmake"
+  "examples/hub/CMakeFiles/pub.dir/DependInfo.cmake"
+  "examples/hub/CMakeFiles/sub.dir/DependInfo.cmake"
+  "examples/idleconnection/CMakeFiles/idleconnection_echo.dir/DependInfo.cmake"
+  "examples/idleconnection/CMakeFiles/idleconnection_echo2.dir/DependInfo.cmake"
+  "examples/maxconnection/CMakeFiles/maxconnection_echo.dir/DependInfo.cmake"
+  "examples/memcached/client/CMakeFiles/memcached_bench.dir/DependInfo.cmake"
+  "examples/memcached/server/CMakeFiles/memcached_debug.dir/DependInfo.cmake"
+  "examples/memcached/server/CMakeFiles/memcached_footprint.dir/DependInfo.cmake"
+  "examples/multiplexer/CMakeFiles/multiplex_server.dir/DependInfo.cmake"
+  "examples/multiplexer/CMakeFiles/multiplex_server_simple.dir/DependInfo.cmake"
+  "examples/multiplexer/CMakeFiles/multiplex_demux.dir/DependInfo.cmake"
+  "examples/netty/discard/CMakeFiles/netty_discard_client.dir/DependInfo.cmake"
+  "examples/netty/discard/CMakeFiles/netty_discard_server.dir/DependInfo.cmake"
+  "examples/netty/echo/CMakeFiles/netty_echo_client.dir/DependInfo.cmake"
+  "examples/netty/echo/CMakeFiles/netty_echo_server.dir/DependInfo.cmake"
+  "examples/netty/echo/CMakeFiles/netty_echo_server2.dir/DependInfo.cmake"
+  "examples/netty/uptime/CMakeFiles/netty_uptime.dir/DependInfo.cmake"
+  "examples/pingpong/CMakeFiles/pingpong_client.dir/DependInfo.cmake"
+  "examples/pingpong/CMakeFiles/pingpong_server.dir/DependInfo.cmake"
+  "examples/pingpong/CMakeFiles/pingpong_bench.dir/DependInfo.cmake"
+  "examples/pingpong/CMakeFiles/pingpong_udp_client.dir/DependInfo.cmake"
+  "examples/pingpong/CMakeFiles/pingpong_udp_server.dir/DependInfo.cmake"
+  "examples/roundtrip/CMakeFiles/roundtrip.dir/DependInfo.cmake"
+  "examples/roundtrip/CMakeFiles/roundtrip_udp.dir/DependInfo.cmake"
+  "examples/shorturl/CMakeFiles/shorturl.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_chargen.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_daytime.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_discard.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_echo.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_time.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_allinone.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_timeclient.dir/DependInfo.cmake"
+  "examples/simple/CMakeFiles/simple_chargenclient.dir/DependInfo.cmake"
+  "examples/socks4a/CMakeFiles/balancer.dir/DependInfo.cmake"
+  "examples/socks4a/CMakeFiles/tcprelay.dir/DependInfo.cmake"
+  "examples/socks4a/CMakeFiles/socks4a.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_solver_basic.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_solver_multiloop.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_solver_threadpool.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_solver_hybrid.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_solver_prod.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_client_batch.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_client_pipeline.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_loadtest.dir/DependInfo.cmake"
+  "examples/sudoku/CMakeFiles/sudoku_stat_unittest.dir/DependInfo.cmake"
+  "examples/twisted/finger/CMakeFiles/twisted_finger01.dir/DependInfo.cmake"
+  "examples/twisted/finger/CMakeFiles/twisted_finger02.dir/DependInfo.cmake"
+  "examples/twisted/finger/CMakeFiles/twisted_finger03.dir/DependInfo.cmake"
+  "examples/twisted/finger/CMakeFiles/twisted_finger04.dir/DependInfo.cmake"
+  "examples/twisted/finger/CMakeFiles/twisted_finger05.dir/DependInfo.cmake"
+  "examples/twisted/finger/CMakeFiles/twisted_finger06.dir/DependInfo.cmake"
+  "examples/twisted/finger/CMakeFiles/twisted_finger07.dir/DependInfo.cmake"
+  "examples/wordcount/CMakeFiles/wordcount_hasher.dir/DependInfo.cmake"
+  "examples/wordcount/CMakeFiles/wordcount_receiver.dir/DependInfo.cmake"
+  "examples/zeromq/CMakeFiles/zeromq_local_lat.dir/DependInfo.cmake"
+  "examples/zeromq/CMakeFiles/zeromq_remote_lat.dir/DependInfo.cmake"
+  "examples/cdns/CMakeFiles/muduo_cdns.dir/DependInfo.cmake"
+  "examples/cdns/CMakeFiles/cdns.dir/DependInfo.cmake"
+  "examples/curl/CMakeFiles/muduo_curl.dir/DependInfo.cmake"
+  "examples/curl/CMakeFiles/mcurl.dir/DependInfo.cmake"
+  "examples/curl/CMakeFiles/curl_download.dir/DependInfo.cmake"
+  "examples/ace/logging/CMakeFiles/ace_logging_proto.dir/DependInfo.cmake"
+  "examples/ace/logging/CMakeFiles/ace_logging_client.dir/DependInfo.cmake"
+  "examples/ace/logging/CMakeFiles/ace_logging_server.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/protobuf_codec.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/query_proto.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/protobuf_codec_test.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/protobuf_dispatcher_lite_test.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/protobuf_dispatcher_test.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/protobuf_server.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/protobuf_client.dir/DependInfo.cmake"
+  "examples/protobuf/codec/CMakeFiles/protobuf_codec_all.dir/DependInfo.cmake"
+  "examples/protobuf/rpc/CMakeFiles/sudoku_proto.dir/DependInfo.cmake"
+  "examples/protobuf/rpc/CMakeFiles/protobuf_rpc_sudoku_client.dir/DependInfo.cmake"
+  "examples/protobuf/rpc/CMakeFiles/protobuf_rpc_sudoku_server.dir/DependInfo.cmake"
+  "examples/protobuf/rpc/CMakeFiles/protobuf_rpc_all.dir/DependInfo.cmake"
+  "examples/protobuf/rpcbalancer/CMakeFiles/protobuf_rpc_balancer.dir/DependInfo.cmake"
+  "examples/protobuf/rpcbalancer/CMakeFiles/protobuf_rpc_balancer_raw.dir/DependInfo.cmake"
+  "examples/protobuf/rpcbench/CMakeFiles/echo_proto.dir/DependInfo.cmake"
+  "examples/protobuf/rpcbench/CMakeFiles/protobuf_rpc_echo_client.dir/DependInfo.cmake"
+  "examples/protobuf/rpcbench/CMakeFiles/protobuf_rpc_echo_server.dir/DependInfo.cmake"
+  "examples/protobuf/resolver/CMakeFiles/resolver_proto.dir/DependInfo.cmake"
+  "examples/protobuf/resolver/CMakeFiles/protobuf_rpc_resolver_client.dir/DependInfo.cmake"
+  "examples/protobuf/resolver/CMakeFiles/protobuf_rpc_resolver_server.dir/DependInfo.cmake"
+  "examples/procmon/CMakeFiles/procmon.dir/DependInfo.cmake"
+  "examples/procmon/CMakeFiles/plot_test.dir/DependInfo.cmake"
+  "examples/procmon/CMakeFiles/dummyload.dir/DependInfo.cmake"
+  )
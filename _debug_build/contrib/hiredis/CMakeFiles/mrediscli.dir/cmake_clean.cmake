@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/mrediscli"
+  "../../bin/mrediscli.pdb"
+  "CMakeFiles/mrediscli.dir/Hiredis.cc.o"
+  "CMakeFiles/mrediscli.dir/Hiredis.cc.o.d"
+  "CMakeFiles/mrediscli.dir/mrediscli.cc.o"
+  "CMakeFiles/mrediscli.dir/mrediscli.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mrediscli.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
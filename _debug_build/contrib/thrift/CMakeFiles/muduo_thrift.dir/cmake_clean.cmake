@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libmuduo_thrift.a"
+  "../../lib/libmuduo_thrift.pdb"
+  "CMakeFiles/muduo_thrift.dir/ThriftConnection.cc.o"
+  "CMakeFiles/muduo_thrift.dir/ThriftConnection.cc.o.d"
+  "CMakeFiles/muduo_thrift.dir/ThriftServer.cc.o"
+  "CMakeFiles/muduo_thrift.dir/ThriftServer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_thrift.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples
+# Build directory: /root/repo/_debug_build/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ace/ttcp")
+subdirs("asio/chat")
+subdirs("asio/tutorial")
+subdirs("fastcgi")
+subdirs("filetransfer")
+subdirs("hub")
+subdirs("idleconnection")
+subdirs("maxconnection")
+subdirs("memcached/client")
+subdirs("memcached/server")
+subdirs("multiplexer")
+subdirs("netty/discard")
+subdirs("netty/echo")
+subdirs("netty/uptime")
+subdirs("pingpong")
+subdirs("roundtrip")
+subdirs("shorturl")
+subdirs("simple")
+subdirs("socks4a")
+subdirs("sudoku")
+subdirs("twisted/finger")
+subdirs("wordcount")
+subdirs("zeromq")
+subdirs("cdns")
+subdirs("curl")
+subdirs("ace/logging")
+subdirs("protobuf")
+subdirs("procmon")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/ace_logging_client"
+  "../../../bin/ace_logging_client.pdb"
+  "CMakeFiles/ace_logging_client.dir/client.cc.o"
+  "CMakeFiles/ace_logging_client.dir/client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ace_logging_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../lib/libace_logging_proto.a"
+  "../../../lib/libace_logging_proto.pdb"
+  "CMakeFiles/ace_logging_proto.dir/logrecord.pb.cc.o"
+  "CMakeFiles/ace_logging_proto.dir/logrecord.pb.cc.o.d"
+  "logrecord.pb.cc"
+  "logrecord.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ace_logging_proto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
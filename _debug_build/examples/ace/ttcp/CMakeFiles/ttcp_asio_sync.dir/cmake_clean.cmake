@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/ttcp_asio_sync"
+  "../../../bin/ttcp_asio_sync.pdb"
+  "CMakeFiles/ttcp_asio_sync.dir/common.cc.o"
+  "CMakeFiles/ttcp_asio_sync.dir/common.cc.o.d"
+  "CMakeFiles/ttcp_asio_sync.dir/main.cc.o"
+  "CMakeFiles/ttcp_asio_sync.dir/main.cc.o.d"
+  "CMakeFiles/ttcp_asio_sync.dir/ttcp_asio_sync.cc.o"
+  "CMakeFiles/ttcp_asio_sync.dir/ttcp_asio_sync.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ttcp_asio_sync.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
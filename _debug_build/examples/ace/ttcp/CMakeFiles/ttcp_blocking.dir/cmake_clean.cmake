@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/ttcp_blocking"
+  "../../../bin/ttcp_blocking.pdb"
+  "CMakeFiles/ttcp_blocking.dir/common.cc.o"
+  "CMakeFiles/ttcp_blocking.dir/common.cc.o.d"
+  "CMakeFiles/ttcp_blocking.dir/main.cc.o"
+  "CMakeFiles/ttcp_blocking.dir/main.cc.o.d"
+  "CMakeFiles/ttcp_blocking.dir/ttcp_blocking.cc.o"
+  "CMakeFiles/ttcp_blocking.dir/ttcp_blocking.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ttcp_blocking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/ttcp_muduo"
+  "../../../bin/ttcp_muduo.pdb"
+  "CMakeFiles/ttcp_muduo.dir/common.cc.o"
+  "CMakeFiles/ttcp_muduo.dir/common.cc.o.d"
+  "CMakeFiles/ttcp_muduo.dir/main.cc.o"
+  "CMakeFiles/ttcp_muduo.dir/main.cc.o.d"
+  "CMakeFiles/ttcp_muduo.dir/ttcp.cc.o"
+  "CMakeFiles/ttcp_muduo.dir/ttcp.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ttcp_muduo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
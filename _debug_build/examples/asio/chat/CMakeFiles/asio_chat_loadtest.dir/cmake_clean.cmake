@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_chat_loadtest"
+  "../../../bin/asio_chat_loadtest.pdb"
+  "CMakeFiles/asio_chat_loadtest.dir/loadtest.cc.o"
+  "CMakeFiles/asio_chat_loadtest.dir/loadtest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_chat_loadtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
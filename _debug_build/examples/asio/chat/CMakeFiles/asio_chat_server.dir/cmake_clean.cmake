@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_chat_server"
+  "../../../bin/asio_chat_server.pdb"
+  "CMakeFiles/asio_chat_server.dir/server.cc.o"
+  "CMakeFiles/asio_chat_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_chat_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_chat_server_threaded_highperformance"
+  "../../../bin/asio_chat_server_threaded_highperformance.pdb"
+  "CMakeFiles/asio_chat_server_threaded_highperformance.dir/server_threaded_highperformance.cc.o"
+  "CMakeFiles/asio_chat_server_threaded_highperformance.dir/server_threaded_highperformance.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_chat_server_threaded_highperformance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_tutorial_timer2"
+  "../../../bin/asio_tutorial_timer2.pdb"
+  "CMakeFiles/asio_tutorial_timer2.dir/timer2/timer.cc.o"
+  "CMakeFiles/asio_tutorial_timer2.dir/timer2/timer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_tutorial_timer2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asio_tutorial_timer4"
+  "../../../bin/asio_tutorial_timer4.pdb"
+  "CMakeFiles/asio_tutorial_timer4.dir/timer4/timer.cc.o"
+  "CMakeFiles/asio_tutorial_timer4.dir/timer4/timer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asio_tutorial_timer4.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
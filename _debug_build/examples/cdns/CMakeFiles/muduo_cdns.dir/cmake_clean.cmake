@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libmuduo_cdns.a"
+  "../../lib/libmuduo_cdns.pdb"
+  "CMakeFiles/muduo_cdns.dir/Resolver.cc.o"
+  "CMakeFiles/muduo_cdns.dir/Resolver.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_cdns.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
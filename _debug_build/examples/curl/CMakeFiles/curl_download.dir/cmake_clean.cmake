@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/curl_download"
+  "../../bin/curl_download.pdb"
+  "CMakeFiles/curl_download.dir/download.cc.o"
+  "CMakeFiles/curl_download.dir/download.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/curl_download.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
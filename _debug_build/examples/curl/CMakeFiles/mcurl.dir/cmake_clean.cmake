@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/mcurl"
+  "../../bin/mcurl.pdb"
+  "CMakeFiles/mcurl.dir/mcurl.cc.o"
+  "CMakeFiles/mcurl.dir/mcurl.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mcurl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../lib/libmuduo_curl.a"
+  "../../lib/libmuduo_curl.pdb"
+  "CMakeFiles/muduo_curl.dir/Curl.cc.o"
+  "CMakeFiles/muduo_curl.dir/Curl.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_curl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../bin/fastcgi_test"
+  "../../bin/fastcgi_test.pdb"
+  "CMakeFiles/fastcgi_test.dir/__/sudoku/sudoku.cc.o"
+  "CMakeFiles/fastcgi_test.dir/__/sudoku/sudoku.cc.o.d"
+  "CMakeFiles/fastcgi_test.dir/fastcgi.cc.o"
+  "CMakeFiles/fastcgi_test.dir/fastcgi.cc.o.d"
+  "CMakeFiles/fastcgi_test.dir/fastcgi_test.cc.o"
+  "CMakeFiles/fastcgi_test.dir/fastcgi_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fastcgi_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/filetransfer_download"
+  "../../bin/filetransfer_download.pdb"
+  "CMakeFiles/filetransfer_download.dir/download.cc.o"
+  "CMakeFiles/filetransfer_download.dir/download.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filetransfer_download.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
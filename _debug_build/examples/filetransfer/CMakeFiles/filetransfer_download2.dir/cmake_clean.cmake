@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/filetransfer_download2"
+  "../../bin/filetransfer_download2.pdb"
+  "CMakeFiles/filetransfer_download2.dir/download2.cc.o"
+  "CMakeFiles/filetransfer_download2.dir/download2.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filetransfer_download2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/filetransfer_download3"
+  "../../bin/filetransfer_download3.pdb"
+  "CMakeFiles/filetransfer_download3.dir/download3.cc.o"
+  "CMakeFiles/filetransfer_download3.dir/download3.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filetransfer_download3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../lib/libmuduo_pubsub.a"
+  "../../lib/libmuduo_pubsub.pdb"
+  "CMakeFiles/muduo_pubsub.dir/codec.cc.o"
+  "CMakeFiles/muduo_pubsub.dir/codec.cc.o.d"
+  "CMakeFiles/muduo_pubsub.dir/pubsub.cc.o"
+  "CMakeFiles/muduo_pubsub.dir/pubsub.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_pubsub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
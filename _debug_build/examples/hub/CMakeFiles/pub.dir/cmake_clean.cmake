@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/pub"
+  "../../bin/pub.pdb"
+  "CMakeFiles/pub.dir/pub.cc.o"
+  "CMakeFiles/pub.dir/pub.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
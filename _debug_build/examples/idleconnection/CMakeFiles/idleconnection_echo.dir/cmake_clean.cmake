@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/idleconnection_echo"
+  "../../bin/idleconnection_echo.pdb"
+  "CMakeFiles/idleconnection_echo.dir/echo.cc.o"
+  "CMakeFiles/idleconnection_echo.dir/echo.cc.o.d"
+  "CMakeFiles/idleconnection_echo.dir/main.cc.o"
+  "CMakeFiles/idleconnection_echo.dir/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/idleconnection_echo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/idleconnection_echo2"
+  "../../bin/idleconnection_echo2.pdb"
+  "CMakeFiles/idleconnection_echo2.dir/sortedlist.cc.o"
+  "CMakeFiles/idleconnection_echo2.dir/sortedlist.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/idleconnection_echo2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
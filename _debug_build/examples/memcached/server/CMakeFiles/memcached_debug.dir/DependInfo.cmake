@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/memcached/server/Item.cc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/Item.cc.o" "gcc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/Item.cc.o.d"
+  "/root/repo/examples/memcached/server/MemcacheServer.cc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/MemcacheServer.cc.o" "gcc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/MemcacheServer.cc.o.d"
+  "/root/repo/examples/memcached/server/Session.cc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/Session.cc.o" "gcc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/Session.cc.o.d"
+  "/root/repo/examples/memcached/server/server.cc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/server.cc.o" "gcc" "examples/memcached/server/CMakeFiles/memcached_debug.dir/server.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/muduo/net/CMakeFiles/muduo_net.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/inspect/CMakeFiles/muduo_inspect.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/http/CMakeFiles/muduo_http.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../bin/memcached_debug"
+  "../../../bin/memcached_debug.pdb"
+  "CMakeFiles/memcached_debug.dir/Item.cc.o"
+  "CMakeFiles/memcached_debug.dir/Item.cc.o.d"
+  "CMakeFiles/memcached_debug.dir/MemcacheServer.cc.o"
+  "CMakeFiles/memcached_debug.dir/MemcacheServer.cc.o.d"
+  "CMakeFiles/memcached_debug.dir/Session.cc.o"
+  "CMakeFiles/memcached_debug.dir/Session.cc.o.d"
+  "CMakeFiles/memcached_debug.dir/server.cc.o"
+  "CMakeFiles/memcached_debug.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/memcached_debug.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/multiplex_demux"
+  "../../bin/multiplex_demux.pdb"
+  "CMakeFiles/multiplex_demux.dir/demux.cc.o"
+  "CMakeFiles/multiplex_demux.dir/demux.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multiplex_demux.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
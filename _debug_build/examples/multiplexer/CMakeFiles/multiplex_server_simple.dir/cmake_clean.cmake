@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/multiplex_server_simple"
+  "../../bin/multiplex_server_simple.pdb"
+  "CMakeFiles/multiplex_server_simple.dir/multiplexer_simple.cc.o"
+  "CMakeFiles/multiplex_server_simple.dir/multiplexer_simple.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/multiplex_server_simple.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
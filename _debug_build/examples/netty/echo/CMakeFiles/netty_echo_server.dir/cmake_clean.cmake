@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/netty_echo_server"
+  "../../../bin/netty_echo_server.pdb"
+  "CMakeFiles/netty_echo_server.dir/server.cc.o"
+  "CMakeFiles/netty_echo_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netty_echo_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
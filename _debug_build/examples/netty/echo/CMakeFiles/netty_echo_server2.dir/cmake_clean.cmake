@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/netty_echo_server2"
+  "../../../bin/netty_echo_server2.pdb"
+  "CMakeFiles/netty_echo_server2.dir/server2.cc.o"
+  "CMakeFiles/netty_echo_server2.dir/server2.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netty_echo_server2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/pingpong_bench"
+  "../../bin/pingpong_bench.pdb"
+  "CMakeFiles/pingpong_bench.dir/bench.cc.o"
+  "CMakeFiles/pingpong_bench.dir/bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pingpong_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/pingpong_udp_client"
+  "../../bin/pingpong_udp_client.pdb"
+  "CMakeFiles/pingpong_udp_client.dir/udp_client.cc.o"
+  "CMakeFiles/pingpong_udp_client.dir/udp_client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pingpong_udp_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/pingpong_udp_server"
+  "../../bin/pingpong_udp_server.pdb"
+  "CMakeFiles/pingpong_udp_server.dir/udp_server.cc.o"
+  "CMakeFiles/pingpong_udp_server.dir/udp_server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pingpong_udp_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
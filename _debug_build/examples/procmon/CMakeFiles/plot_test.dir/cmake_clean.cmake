@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/plot_test"
+  "../../bin/plot_test.pdb"
+  "CMakeFiles/plot_test.dir/plot.cc.o"
+  "CMakeFiles/plot_test.dir/plot.cc.o.d"
+  "CMakeFiles/plot_test.dir/plot_test.cc.o"
+  "CMakeFiles/plot_test.dir/plot_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/plot_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
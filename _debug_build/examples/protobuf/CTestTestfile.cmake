@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/protobuf
+# Build directory: /root/repo/_debug_build/examples/protobuf
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("codec")
+subdirs("rpc")
+subdirs("rpcbalancer")
+subdirs("rpcbench")
+subdirs("resolver")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libprotobuf_codec.a"
+  "../../../lib/libprotobuf_codec.pdb"
+  "CMakeFiles/protobuf_codec.dir/codec.cc.o"
+  "CMakeFiles/protobuf_codec.dir/codec.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_codec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
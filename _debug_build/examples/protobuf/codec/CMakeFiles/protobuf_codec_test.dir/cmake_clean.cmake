@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_codec_test"
+  "../../../bin/protobuf_codec_test.pdb"
+  "CMakeFiles/protobuf_codec_test.dir/codec_test.cc.o"
+  "CMakeFiles/protobuf_codec_test.dir/codec_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_codec_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
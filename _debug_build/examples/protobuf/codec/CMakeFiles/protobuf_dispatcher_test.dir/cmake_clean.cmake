@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_dispatcher_test"
+  "../../../bin/protobuf_dispatcher_test.pdb"
+  "CMakeFiles/protobuf_dispatcher_test.dir/dispatcher_test.cc.o"
+  "CMakeFiles/protobuf_dispatcher_test.dir/dispatcher_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_dispatcher_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
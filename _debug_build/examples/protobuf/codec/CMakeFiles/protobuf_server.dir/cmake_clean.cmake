@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_server"
+  "../../../bin/protobuf_server.pdb"
+  "CMakeFiles/protobuf_server.dir/server.cc.o"
+  "CMakeFiles/protobuf_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
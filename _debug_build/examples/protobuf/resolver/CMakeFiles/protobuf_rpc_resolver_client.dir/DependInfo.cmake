@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/protobuf/resolver/client.cc" "examples/protobuf/resolver/CMakeFiles/protobuf_rpc_resolver_client.dir/client.cc.o" "gcc" "examples/protobuf/resolver/CMakeFiles/protobuf_rpc_resolver_client.dir/client.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/examples/protobuf/resolver/CMakeFiles/resolver_proto.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/protorpc/CMakeFiles/muduo_protorpc.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/protorpc/CMakeFiles/muduo_protorpc_wire.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/protobuf/CMakeFiles/muduo_protobuf_codec.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/inspect/CMakeFiles/muduo_inspect.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/http/CMakeFiles/muduo_http.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/CMakeFiles/muduo_net.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
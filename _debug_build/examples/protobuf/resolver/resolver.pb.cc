@@ -0,0 +1,704 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resolver.proto
+
+#include "resolver.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace resolver {
+PROTOBUF_CONSTEXPR ResolveRequest::ResolveRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ResolveRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResolveRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResolveRequestDefaultTypeInternal() {}
+  union {
+    ResolveRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResolveRequestDefaultTypeInternal _ResolveRequest_default_instance_;
+PROTOBUF_CONSTEXPR ResolveResponse::ResolveResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.ip_)*/{}
+  , /*decltype(_impl_.port_)*/{}
+  , /*decltype(_impl_.resolved_)*/false} {}
+struct ResolveResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResolveResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResolveResponseDefaultTypeInternal() {}
+  union {
+    ResolveResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResolveResponseDefaultTypeInternal _ResolveResponse_default_instance_;
+}  // namespace resolver
+static ::_pb::Metadata file_level_metadata_resolver_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_resolver_2eproto = nullptr;
+static const ::_pb::ServiceDescriptor* file_level_service_descriptors_resolver_2eproto[1];
+
+const uint32_t TableStruct_resolver_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveRequest, _impl_.address_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveResponse, _impl_.resolved_),
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveResponse, _impl_.ip_),
+  PROTOBUF_FIELD_OFFSET(::resolver::ResolveResponse, _impl_.port_),
+  0,
+  ~0u,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 7, -1, sizeof(::resolver::ResolveRequest)},
+  { 8, 17, -1, sizeof(::resolver::ResolveResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::resolver::_ResolveRequest_default_instance_._instance,
+  &::resolver::_ResolveResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_resolver_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016resolver.proto\022\010resolver\"!\n\016ResolveReq"
+  "uest\022\017\n\007address\030\001 \002(\t\"D\n\017ResolveResponse"
+  "\022\027\n\010resolved\030\001 \001(\010:\005false\022\n\n\002ip\030\002 \003(\007\022\014\n"
+  "\004port\030\003 \003(\0052Q\n\017ResolverService\022>\n\007Resolv"
+  "e\022\030.resolver.ResolveRequest\032\031.resolver.R"
+  "esolveResponseB\t\200\001\001\210\001\001\220\001\001"
+  ;
+static ::_pbi::once_flag descriptor_table_resolver_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_resolver_2eproto = {
+    false, false, 225, descriptor_table_protodef_resolver_2eproto,
+    "resolver.proto",
+    &descriptor_table_resolver_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_resolver_2eproto::offsets,
+    file_level_metadata_resolver_2eproto, file_level_enum_descriptors_resolver_2eproto,
+    file_level_service_descriptors_resolver_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_resolver_2eproto_getter() {
+  return &descriptor_table_resolver_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_resolver_2eproto(&descriptor_table_resolver_2eproto);
+namespace resolver {
+
+// ===================================================================
+
+class ResolveRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResolveRequest>()._impl_._has_bits_);
+  static void set_has_address(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ResolveRequest::ResolveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:resolver.ResolveRequest)
+}
+ResolveRequest::ResolveRequest(const ResolveRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResolveRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.address_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_address()) {
+    _this->_impl_.address_.Set(from._internal_address(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:resolver.ResolveRequest)
+}
+
+inline void ResolveRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.address_){}
+  };
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResolveRequest::~ResolveRequest() {
+  // @@protoc_insertion_point(destructor:resolver.ResolveRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResolveRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.address_.Destroy();
+}
+
+void ResolveRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResolveRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:resolver.ResolveRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.address_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResolveRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string address = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "resolver.ResolveRequest.address");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResolveRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:resolver.ResolveRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string address = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_address().data(), static_cast<int>(this->_internal_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "resolver.ResolveRequest.address");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_address(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:resolver.ResolveRequest)
+  return target;
+}
+
+size_t ResolveRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:resolver.ResolveRequest)
+  size_t total_size = 0;
+
+  // required string address = 1;
+  if (_internal_has_address()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_address());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResolveRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResolveRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResolveRequest::GetClassData() const { return &_class_data_; }
+
+
+void ResolveRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResolveRequest*>(&to_msg);
+  auto& from = static_cast<const ResolveRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:resolver.ResolveRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_address()) {
+    _this->_internal_set_address(from._internal_address());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResolveRequest::CopyFrom(const ResolveRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:resolver.ResolveRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResolveRequest::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ResolveRequest::InternalSwap(ResolveRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.address_, lhs_arena,
+      &other->_impl_.address_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResolveRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resolver_2eproto_getter, &descriptor_table_resolver_2eproto_once,
+      file_level_metadata_resolver_2eproto[0]);
+}
+
+// ===================================================================
+
+class ResolveResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResolveResponse>()._impl_._has_bits_);
+  static void set_has_resolved(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+ResolveResponse::ResolveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:resolver.ResolveResponse)
+}
+ResolveResponse::ResolveResponse(const ResolveResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResolveResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){from._impl_.ip_}
+    , decltype(_impl_.port_){from._impl_.port_}
+    , decltype(_impl_.resolved_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.resolved_ = from._impl_.resolved_;
+  // @@protoc_insertion_point(copy_constructor:resolver.ResolveResponse)
+}
+
+inline void ResolveResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.ip_){arena}
+    , decltype(_impl_.port_){arena}
+    , decltype(_impl_.resolved_){false}
+  };
+}
+
+ResolveResponse::~ResolveResponse() {
+  // @@protoc_insertion_point(destructor:resolver.ResolveResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResolveResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ip_.~RepeatedField();
+  _impl_.port_.~RepeatedField();
+}
+
+void ResolveResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResolveResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:resolver.ResolveResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ip_.Clear();
+  _impl_.port_.Clear();
+  _impl_.resolved_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResolveResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bool resolved = 1 [default = false];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_resolved(&has_bits);
+          _impl_.resolved_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated fixed32 ip = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_ip(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr));
+            ptr += sizeof(uint32_t);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<21>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed32Parser(_internal_mutable_ip(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 port = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_port(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_port(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResolveResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:resolver.ResolveResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bool resolved = 1 [default = false];
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_resolved(), target);
+  }
+
+  // repeated fixed32 ip = 2;
+  for (int i = 0, n = this->_internal_ip_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(2, this->_internal_ip(i), target);
+  }
+
+  // repeated int32 port = 3;
+  for (int i = 0, n = this->_internal_port_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_port(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:resolver.ResolveResponse)
+  return target;
+}
+
+size_t ResolveResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:resolver.ResolveResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated fixed32 ip = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_ip_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_ip_size());
+    total_size += data_size;
+  }
+
+  // repeated int32 port = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.port_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_port_size());
+    total_size += data_size;
+  }
+
+  // optional bool resolved = 1 [default = false];
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResolveResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResolveResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResolveResponse::GetClassData() const { return &_class_data_; }
+
+
+void ResolveResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResolveResponse*>(&to_msg);
+  auto& from = static_cast<const ResolveResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:resolver.ResolveResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ip_.MergeFrom(from._impl_.ip_);
+  _this->_impl_.port_.MergeFrom(from._impl_.port_);
+  if (from._internal_has_resolved()) {
+    _this->_internal_set_resolved(from._internal_resolved());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResolveResponse::CopyFrom(const ResolveResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:resolver.ResolveResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResolveResponse::IsInitialized() const {
+  return true;
+}
+
+void ResolveResponse::InternalSwap(ResolveResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.ip_.InternalSwap(&other->_impl_.ip_);
+  _impl_.port_.InternalSwap(&other->_impl_.port_);
+  swap(_impl_.resolved_, other->_impl_.resolved_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResolveResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_resolver_2eproto_getter, &descriptor_table_resolver_2eproto_once,
+      file_level_metadata_resolver_2eproto[1]);
+}
+
+// ===================================================================
+
+ResolverService::~ResolverService() {}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* ResolverService::descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_resolver_2eproto);
+  return file_level_service_descriptors_resolver_2eproto[0];
+}
+
+const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* ResolverService::GetDescriptor() {
+  return descriptor();
+}
+
+void ResolverService::Resolve(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                         const ::resolver::ResolveRequest*,
+                         ::resolver::ResolveResponse*,
+                         ::google::protobuf::Closure* done) {
+  controller->SetFailed("Method Resolve() not implemented.");
+  done->Run();
+}
+
+void ResolverService::CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                             ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                             const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                             ::PROTOBUF_NAMESPACE_ID::Message* response,
+                             ::google::protobuf::Closure* done) {
+  GOOGLE_DCHECK_EQ(method->service(), file_level_service_descriptors_resolver_2eproto[0]);
+  switch(method->index()) {
+    case 0:
+      Resolve(controller,
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ::resolver::ResolveRequest*>(
+                 request),
+             ::PROTOBUF_NAMESPACE_ID::internal::DownCast<::resolver::ResolveResponse*>(
+                 response),
+             done);
+      break;
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      break;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& ResolverService::GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::resolver::ResolveRequest::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->input_type());
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message& ResolverService::GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const {
+  GOOGLE_DCHECK_EQ(method->service(), descriptor());
+  switch(method->index()) {
+    case 0:
+      return ::resolver::ResolveResponse::default_instance();
+    default:
+      GOOGLE_LOG(FATAL) << "Bad method index; this should never happen.";
+      return *::PROTOBUF_NAMESPACE_ID::MessageFactory::generated_factory()
+          ->GetPrototype(method->output_type());
+  }
+}
+
+ResolverService_Stub::ResolverService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel)
+  : channel_(channel), owns_channel_(false) {}
+ResolverService_Stub::ResolverService_Stub(
+    ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+    ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership)
+  : channel_(channel),
+    owns_channel_(ownership == ::PROTOBUF_NAMESPACE_ID::Service::STUB_OWNS_CHANNEL) {}
+ResolverService_Stub::~ResolverService_Stub() {
+  if (owns_channel_) delete channel_;
+}
+
+void ResolverService_Stub::Resolve(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                              const ::resolver::ResolveRequest* request,
+                              ::resolver::ResolveResponse* response,
+                              ::google::protobuf::Closure* done) {
+  channel_->CallMethod(descriptor()->method(0),
+                       controller, request, response, done);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace resolver
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::resolver::ResolveRequest*
+Arena::CreateMaybeMessage< ::resolver::ResolveRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::resolver::ResolveRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::resolver::ResolveResponse*
+Arena::CreateMaybeMessage< ::resolver::ResolveResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::resolver::ResolveResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,712 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: resolver.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_resolver_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_resolver_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/service.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_resolver_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_resolver_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_resolver_2eproto;
+namespace resolver {
+class ResolveRequest;
+struct ResolveRequestDefaultTypeInternal;
+extern ResolveRequestDefaultTypeInternal _ResolveRequest_default_instance_;
+class ResolveResponse;
+struct ResolveResponseDefaultTypeInternal;
+extern ResolveResponseDefaultTypeInternal _ResolveResponse_default_instance_;
+}  // namespace resolver
+PROTOBUF_NAMESPACE_OPEN
+template<> ::resolver::ResolveRequest* Arena::CreateMaybeMessage<::resolver::ResolveRequest>(Arena*);
+template<> ::resolver::ResolveResponse* Arena::CreateMaybeMessage<::resolver::ResolveResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace resolver {
+
+// ===================================================================
+
+class ResolveRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:resolver.ResolveRequest) */ {
+ public:
+  inline ResolveRequest() : ResolveRequest(nullptr) {}
+  ~ResolveRequest() override;
+  explicit PROTOBUF_CONSTEXPR ResolveRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResolveRequest(const ResolveRequest& from);
+  ResolveRequest(ResolveRequest&& from) noexcept
+    : ResolveRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ResolveRequest& operator=(const ResolveRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResolveRequest& operator=(ResolveRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResolveRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResolveRequest* internal_default_instance() {
+    return reinterpret_cast<const ResolveRequest*>(
+               &_ResolveRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ResolveRequest& a, ResolveRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResolveRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResolveRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResolveRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResolveRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResolveRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResolveRequest& from) {
+    ResolveRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResolveRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "resolver.ResolveRequest";
+  }
+  protected:
+  explicit ResolveRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAddressFieldNumber = 1,
+  };
+  // required string address = 1;
+  bool has_address() const;
+  private:
+  bool _internal_has_address() const;
+  public:
+  void clear_address();
+  const std::string& address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_address();
+  PROTOBUF_NODISCARD std::string* release_address();
+  void set_allocated_address(std::string* address);
+  private:
+  const std::string& _internal_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_address(const std::string& value);
+  std::string* _internal_mutable_address();
+  public:
+
+  // @@protoc_insertion_point(class_scope:resolver.ResolveRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr address_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resolver_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResolveResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:resolver.ResolveResponse) */ {
+ public:
+  inline ResolveResponse() : ResolveResponse(nullptr) {}
+  ~ResolveResponse() override;
+  explicit PROTOBUF_CONSTEXPR ResolveResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResolveResponse(const ResolveResponse& from);
+  ResolveResponse(ResolveResponse&& from) noexcept
+    : ResolveResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline ResolveResponse& operator=(const ResolveResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResolveResponse& operator=(ResolveResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResolveResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResolveResponse* internal_default_instance() {
+    return reinterpret_cast<const ResolveResponse*>(
+               &_ResolveResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ResolveResponse& a, ResolveResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResolveResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResolveResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResolveResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResolveResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResolveResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResolveResponse& from) {
+    ResolveResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResolveResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "resolver.ResolveResponse";
+  }
+  protected:
+  explicit ResolveResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIpFieldNumber = 2,
+    kPortFieldNumber = 3,
+    kResolvedFieldNumber = 1,
+  };
+  // repeated fixed32 ip = 2;
+  int ip_size() const;
+  private:
+  int _internal_ip_size() const;
+  public:
+  void clear_ip();
+  private:
+  uint32_t _internal_ip(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ip() const;
+  void _internal_add_ip(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ip();
+  public:
+  uint32_t ip(int index) const;
+  void set_ip(int index, uint32_t value);
+  void add_ip(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ip() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ip();
+
+  // repeated int32 port = 3;
+  int port_size() const;
+  private:
+  int _internal_port_size() const;
+  public:
+  void clear_port();
+  private:
+  int32_t _internal_port(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_port() const;
+  void _internal_add_port(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_port();
+  public:
+  int32_t port(int index) const;
+  void set_port(int index, int32_t value);
+  void add_port(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      port() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_port();
+
+  // optional bool resolved = 1 [default = false];
+  bool has_resolved() const;
+  private:
+  bool _internal_has_resolved() const;
+  public:
+  void clear_resolved();
+  bool resolved() const;
+  void set_resolved(bool value);
+  private:
+  bool _internal_resolved() const;
+  void _internal_set_resolved(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:resolver.ResolveResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ip_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > port_;
+    bool resolved_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_resolver_2eproto;
+};
+// ===================================================================
+
+class ResolverService_Stub;
+
+class ResolverService : public ::PROTOBUF_NAMESPACE_ID::Service {
+ protected:
+  // This class should be treated as an abstract interface.
+  inline ResolverService() {};
+ public:
+  virtual ~ResolverService();
+
+  typedef ResolverService_Stub Stub;
+
+  static const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* descriptor();
+
+  virtual void Resolve(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::resolver::ResolveRequest* request,
+                       ::resolver::ResolveResponse* response,
+                       ::google::protobuf::Closure* done);
+
+  // implements Service ----------------------------------------------
+
+  const ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor* GetDescriptor();
+  void CallMethod(const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method,
+                  ::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                  const ::PROTOBUF_NAMESPACE_ID::Message* request,
+                  ::PROTOBUF_NAMESPACE_ID::Message* response,
+                  ::google::protobuf::Closure* done);
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetRequestPrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+  const ::PROTOBUF_NAMESPACE_ID::Message& GetResponsePrototype(
+    const ::PROTOBUF_NAMESPACE_ID::MethodDescriptor* method) const;
+
+ private:
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ResolverService);
+};
+
+class ResolverService_Stub : public ResolverService {
+ public:
+  ResolverService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel);
+  ResolverService_Stub(::PROTOBUF_NAMESPACE_ID::RpcChannel* channel,
+                   ::PROTOBUF_NAMESPACE_ID::Service::ChannelOwnership ownership);
+  ~ResolverService_Stub();
+
+  inline ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel() { return channel_; }
+
+  // implements ResolverService ------------------------------------------
+
+  void Resolve(::PROTOBUF_NAMESPACE_ID::RpcController* controller,
+                       const ::resolver::ResolveRequest* request,
+                       ::resolver::ResolveResponse* response,
+                       ::google::protobuf::Closure* done);
+ private:
+  ::PROTOBUF_NAMESPACE_ID::RpcChannel* channel_;
+  bool owns_channel_;
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ResolverService_Stub);
+};
+
+
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ResolveRequest
+
+// required string address = 1;
+inline bool ResolveRequest::_internal_has_address() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResolveRequest::has_address() const {
+  return _internal_has_address();
+}
+inline void ResolveRequest::clear_address() {
+  _impl_.address_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResolveRequest::address() const {
+  // @@protoc_insertion_point(field_get:resolver.ResolveRequest.address)
+  return _internal_address();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResolveRequest::set_address(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:resolver.ResolveRequest.address)
+}
+inline std::string* ResolveRequest::mutable_address() {
+  std::string* _s = _internal_mutable_address();
+  // @@protoc_insertion_point(field_mutable:resolver.ResolveRequest.address)
+  return _s;
+}
+inline const std::string& ResolveRequest::_internal_address() const {
+  return _impl_.address_.Get();
+}
+inline void ResolveRequest::_internal_set_address(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.address_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResolveRequest::_internal_mutable_address() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.address_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResolveRequest::release_address() {
+  // @@protoc_insertion_point(field_release:resolver.ResolveRequest.address)
+  if (!_internal_has_address()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.address_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResolveRequest::set_allocated_address(std::string* address) {
+  if (address != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.address_.SetAllocated(address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.address_.IsDefault()) {
+    _impl_.address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:resolver.ResolveRequest.address)
+}
+
+// -------------------------------------------------------------------
+
+// ResolveResponse
+
+// optional bool resolved = 1 [default = false];
+inline bool ResolveResponse::_internal_has_resolved() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResolveResponse::has_resolved() const {
+  return _internal_has_resolved();
+}
+inline void ResolveResponse::clear_resolved() {
+  _impl_.resolved_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool ResolveResponse::_internal_resolved() const {
+  return _impl_.resolved_;
+}
+inline bool ResolveResponse::resolved() const {
+  // @@protoc_insertion_point(field_get:resolver.ResolveResponse.resolved)
+  return _internal_resolved();
+}
+inline void ResolveResponse::_internal_set_resolved(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.resolved_ = value;
+}
+inline void ResolveResponse::set_resolved(bool value) {
+  _internal_set_resolved(value);
+  // @@protoc_insertion_point(field_set:resolver.ResolveResponse.resolved)
+}
+
+// repeated fixed32 ip = 2;
+inline int ResolveResponse::_internal_ip_size() const {
+  return _impl_.ip_.size();
+}
+inline int ResolveResponse::ip_size() const {
+  return _internal_ip_size();
+}
+inline void ResolveResponse::clear_ip() {
+  _impl_.ip_.Clear();
+}
+inline uint32_t ResolveResponse::_internal_ip(int index) const {
+  return _impl_.ip_.Get(index);
+}
+inline uint32_t ResolveResponse::ip(int index) const {
+  // @@protoc_insertion_point(field_get:resolver.ResolveResponse.ip)
+  return _internal_ip(index);
+}
+inline void ResolveResponse::set_ip(int index, uint32_t value) {
+  _impl_.ip_.Set(index, value);
+  // @@protoc_insertion_point(field_set:resolver.ResolveResponse.ip)
+}
+inline void ResolveResponse::_internal_add_ip(uint32_t value) {
+  _impl_.ip_.Add(value);
+}
+inline void ResolveResponse::add_ip(uint32_t value) {
+  _internal_add_ip(value);
+  // @@protoc_insertion_point(field_add:resolver.ResolveResponse.ip)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ResolveResponse::_internal_ip() const {
+  return _impl_.ip_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ResolveResponse::ip() const {
+  // @@protoc_insertion_point(field_list:resolver.ResolveResponse.ip)
+  return _internal_ip();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ResolveResponse::_internal_mutable_ip() {
+  return &_impl_.ip_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ResolveResponse::mutable_ip() {
+  // @@protoc_insertion_point(field_mutable_list:resolver.ResolveResponse.ip)
+  return _internal_mutable_ip();
+}
+
+// repeated int32 port = 3;
+inline int ResolveResponse::_internal_port_size() const {
+  return _impl_.port_.size();
+}
+inline int ResolveResponse::port_size() const {
+  return _internal_port_size();
+}
+inline void ResolveResponse::clear_port() {
+  _impl_.port_.Clear();
+}
+inline int32_t ResolveResponse::_internal_port(int index) const {
+  return _impl_.port_.Get(index);
+}
+inline int32_t ResolveResponse::port(int index) const {
+  // @@protoc_insertion_point(field_get:resolver.ResolveResponse.port)
+  return _internal_port(index);
+}
+inline void ResolveResponse::set_port(int index, int32_t value) {
+  _impl_.port_.Set(index, value);
+  // @@protoc_insertion_point(field_set:resolver.ResolveResponse.port)
+}
+inline void ResolveResponse::_internal_add_port(int32_t value) {
+  _impl_.port_.Add(value);
+}
+inline void ResolveResponse::add_port(int32_t value) {
+  _internal_add_port(value);
+  // @@protoc_insertion_point(field_add:resolver.ResolveResponse.port)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ResolveResponse::_internal_port() const {
+  return _impl_.port_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+ResolveResponse::port() const {
+  // @@protoc_insertion_point(field_list:resolver.ResolveResponse.port)
+  return _internal_port();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ResolveResponse::_internal_mutable_port() {
+  return &_impl_.port_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+ResolveResponse::mutable_port() {
+  // @@protoc_insertion_point(field_mutable_list:resolver.ResolveResponse.port)
+  return _internal_mutable_port();
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace resolver
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_resolver_2eproto
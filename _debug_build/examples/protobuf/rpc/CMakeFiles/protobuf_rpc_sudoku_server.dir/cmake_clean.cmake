@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_rpc_sudoku_server"
+  "../../../bin/protobuf_rpc_sudoku_server.pdb"
+  "CMakeFiles/protobuf_rpc_sudoku_server.dir/server.cc.o"
+  "CMakeFiles/protobuf_rpc_sudoku_server.dir/server.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_rpc_sudoku_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
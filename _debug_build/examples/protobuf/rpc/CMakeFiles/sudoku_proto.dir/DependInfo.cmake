@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/examples/protobuf/rpc/sudoku.pb.cc" "examples/protobuf/rpc/CMakeFiles/sudoku_proto.dir/sudoku.pb.cc.o" "gcc" "examples/protobuf/rpc/CMakeFiles/sudoku_proto.dir/sudoku.pb.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/examples/protobuf/rpc/sudoku.pb.h" "/root/repo/_debug_build/examples/protobuf/rpc/sudoku.pb.cc"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_rpc_balancer"
+  "../../../bin/protobuf_rpc_balancer.pdb"
+  "CMakeFiles/protobuf_rpc_balancer.dir/balancer.cc.o"
+  "CMakeFiles/protobuf_rpc_balancer.dir/balancer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_rpc_balancer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_rpc_echo_client"
+  "../../../bin/protobuf_rpc_echo_client.pdb"
+  "CMakeFiles/protobuf_rpc_echo_client.dir/client.cc.o"
+  "CMakeFiles/protobuf_rpc_echo_client.dir/client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_rpc_echo_client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/roundtrip"
+  "../../bin/roundtrip.pdb"
+  "CMakeFiles/roundtrip.dir/roundtrip.cc.o"
+  "CMakeFiles/roundtrip.dir/roundtrip.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/roundtrip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_allinone"
+  "../../bin/simple_allinone.pdb"
+  "CMakeFiles/simple_allinone.dir/allinone/allinone.cc.o"
+  "CMakeFiles/simple_allinone.dir/allinone/allinone.cc.o.d"
+  "CMakeFiles/simple_allinone.dir/chargen/chargen.cc.o"
+  "CMakeFiles/simple_allinone.dir/chargen/chargen.cc.o.d"
+  "CMakeFiles/simple_allinone.dir/daytime/daytime.cc.o"
+  "CMakeFiles/simple_allinone.dir/daytime/daytime.cc.o.d"
+  "CMakeFiles/simple_allinone.dir/discard/discard.cc.o"
+  "CMakeFiles/simple_allinone.dir/discard/discard.cc.o.d"
+  "CMakeFiles/simple_allinone.dir/echo/echo.cc.o"
+  "CMakeFiles/simple_allinone.dir/echo/echo.cc.o.d"
+  "CMakeFiles/simple_allinone.dir/time/time.cc.o"
+  "CMakeFiles/simple_allinone.dir/time/time.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_allinone.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_daytime"
+  "../../bin/simple_daytime.pdb"
+  "CMakeFiles/simple_daytime.dir/daytime/daytime.cc.o"
+  "CMakeFiles/simple_daytime.dir/daytime/daytime.cc.o.d"
+  "CMakeFiles/simple_daytime.dir/daytime/main.cc.o"
+  "CMakeFiles/simple_daytime.dir/daytime/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_daytime.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
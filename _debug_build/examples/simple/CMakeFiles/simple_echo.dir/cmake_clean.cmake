@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/simple_echo"
+  "../../bin/simple_echo.pdb"
+  "CMakeFiles/simple_echo.dir/echo/echo.cc.o"
+  "CMakeFiles/simple_echo.dir/echo/echo.cc.o.d"
+  "CMakeFiles/simple_echo.dir/echo/main.cc.o"
+  "CMakeFiles/simple_echo.dir/echo/main.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple_echo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/balancer"
+  "../../bin/balancer.pdb"
+  "CMakeFiles/balancer.dir/balancer.cc.o"
+  "CMakeFiles/balancer.dir/balancer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/balancer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/tcprelay"
+  "../../bin/tcprelay.pdb"
+  "CMakeFiles/tcprelay.dir/tcprelay.cc.o"
+  "CMakeFiles/tcprelay.dir/tcprelay.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcprelay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_client_batch"
+  "../../bin/sudoku_client_batch.pdb"
+  "CMakeFiles/sudoku_client_batch.dir/batch.cc.o"
+  "CMakeFiles/sudoku_client_batch.dir/batch.cc.o.d"
+  "CMakeFiles/sudoku_client_batch.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_client_batch.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_client_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_client_pipeline"
+  "../../bin/sudoku_client_pipeline.pdb"
+  "CMakeFiles/sudoku_client_pipeline.dir/pipeline.cc.o"
+  "CMakeFiles/sudoku_client_pipeline.dir/pipeline.cc.o.d"
+  "CMakeFiles/sudoku_client_pipeline.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_client_pipeline.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_client_pipeline.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
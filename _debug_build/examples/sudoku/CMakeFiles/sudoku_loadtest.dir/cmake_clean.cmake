@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_loadtest"
+  "../../bin/sudoku_loadtest.pdb"
+  "CMakeFiles/sudoku_loadtest.dir/loadtest.cc.o"
+  "CMakeFiles/sudoku_loadtest.dir/loadtest.cc.o.d"
+  "CMakeFiles/sudoku_loadtest.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_loadtest.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_loadtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_solver_basic"
+  "../../bin/sudoku_solver_basic.pdb"
+  "CMakeFiles/sudoku_solver_basic.dir/server_basic.cc.o"
+  "CMakeFiles/sudoku_solver_basic.dir/server_basic.cc.o.d"
+  "CMakeFiles/sudoku_solver_basic.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_solver_basic.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_solver_basic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_solver_hybrid"
+  "../../bin/sudoku_solver_hybrid.pdb"
+  "CMakeFiles/sudoku_solver_hybrid.dir/server_hybrid.cc.o"
+  "CMakeFiles/sudoku_solver_hybrid.dir/server_hybrid.cc.o.d"
+  "CMakeFiles/sudoku_solver_hybrid.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_solver_hybrid.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_solver_hybrid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
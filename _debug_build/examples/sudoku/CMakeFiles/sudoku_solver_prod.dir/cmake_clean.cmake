@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../bin/sudoku_solver_prod"
+  "../../bin/sudoku_solver_prod.pdb"
+  "CMakeFiles/sudoku_solver_prod.dir/server_prod.cc.o"
+  "CMakeFiles/sudoku_solver_prod.dir/server_prod.cc.o.d"
+  "CMakeFiles/sudoku_solver_prod.dir/sudoku.cc.o"
+  "CMakeFiles/sudoku_solver_prod.dir/sudoku.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sudoku_solver_prod.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
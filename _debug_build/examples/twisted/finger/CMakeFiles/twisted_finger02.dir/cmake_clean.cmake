@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/twisted_finger02"
+  "../../../bin/twisted_finger02.pdb"
+  "CMakeFiles/twisted_finger02.dir/finger02.cc.o"
+  "CMakeFiles/twisted_finger02.dir/finger02.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/twisted_finger02.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/twisted_finger03"
+  "../../../bin/twisted_finger03.pdb"
+  "CMakeFiles/twisted_finger03.dir/finger03.cc.o"
+  "CMakeFiles/twisted_finger03.dir/finger03.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/twisted_finger03.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
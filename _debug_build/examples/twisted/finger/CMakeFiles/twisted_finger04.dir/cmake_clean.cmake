@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/twisted_finger04"
+  "../../../bin/twisted_finger04.pdb"
+  "CMakeFiles/twisted_finger04.dir/finger04.cc.o"
+  "CMakeFiles/twisted_finger04.dir/finger04.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/twisted_finger04.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
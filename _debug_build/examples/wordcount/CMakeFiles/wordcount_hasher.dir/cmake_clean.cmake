@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/wordcount_hasher"
+  "../../bin/wordcount_hasher.pdb"
+  "CMakeFiles/wordcount_hasher.dir/hasher.cc.o"
+  "CMakeFiles/wordcount_hasher.dir/hasher.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wordcount_hasher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
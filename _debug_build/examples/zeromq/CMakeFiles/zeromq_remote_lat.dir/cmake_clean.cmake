@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../bin/zeromq_remote_lat"
+  "../../bin/zeromq_remote_lat.pdb"
+  "CMakeFiles/zeromq_remote_lat.dir/remote_lat.cc.o"
+  "CMakeFiles/zeromq_remote_lat.dir/remote_lat.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zeromq_remote_lat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,88 @@
+# Install script for directory: /root/repo/muduo/base
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE STATIC_LIBRARY FILES "/root/repo/_debug_build/lib/libmuduo_base.a")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/muduo/base" TYPE FILE FILES
+    "/root/repo/muduo/base/AsyncLogging.h"
+    "/root/repo/muduo/base/Atomic.h"
+    "/root/repo/muduo/base/BlockingQueue.h"
+    "/root/repo/muduo/base/BoundedBlockingQueue.h"
+    "/root/repo/muduo/base/Condition.h"
+    "/root/repo/muduo/base/CountDownLatch.h"
+    "/root/repo/muduo/base/CurrentThread.h"
+    "/root/repo/muduo/base/Date.h"
+    "/root/repo/muduo/base/Exception.h"
+    "/root/repo/muduo/base/FileUtil.h"
+    "/root/repo/muduo/base/GzipFile.h"
+    "/root/repo/muduo/base/LogFile.h"
+    "/root/repo/muduo/base/LogStream.h"
+    "/root/repo/muduo/base/Logging.h"
+    "/root/repo/muduo/base/Mutex.h"
+    "/root/repo/muduo/base/ProcessInfo.h"
+    "/root/repo/muduo/base/Singleton.h"
+    "/root/repo/muduo/base/StringPiece.h"
+    "/root/repo/muduo/base/Thread.h"
+    "/root/repo/muduo/base/ThreadAffinity.h"
+    "/root/repo/muduo/base/ThreadLocal.h"
+    "/root/repo/muduo/base/ThreadLocalSingleton.h"
+    "/root/repo/muduo/base/ThreadPool.h"
+    "/root/repo/muduo/base/TimeZone.h"
+    "/root/repo/muduo/base/Timestamp.h"
+    "/root/repo/muduo/base/Types.h"
+    "/root/repo/muduo/base/WeakCallback.h"
+    "/root/repo/muduo/base/copyable.h"
+    "/root/repo/muduo/base/noncopyable.h"
+    )
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for each subdirectory.
+  include("/root/repo/_debug_build/muduo/base/tests/cmake_install.cmake")
+
+endif()
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/asynclogging_test"
+  "../../../bin/asynclogging_test.pdb"
+  "CMakeFiles/asynclogging_test.dir/AsyncLogging_test.cc.o"
+  "CMakeFiles/asynclogging_test.dir/AsyncLogging_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/asynclogging_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
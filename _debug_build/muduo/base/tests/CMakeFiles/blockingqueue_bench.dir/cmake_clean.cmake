@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/blockingqueue_bench"
+  "../../../bin/blockingqueue_bench.pdb"
+  "CMakeFiles/blockingqueue_bench.dir/BlockingQueue_bench.cc.o"
+  "CMakeFiles/blockingqueue_bench.dir/BlockingQueue_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blockingqueue_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
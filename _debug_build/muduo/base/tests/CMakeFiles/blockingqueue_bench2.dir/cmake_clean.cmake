@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/blockingqueue_bench2"
+  "../../../bin/blockingqueue_bench2.pdb"
+  "CMakeFiles/blockingqueue_bench2.dir/BlockingQueue_bench2.cc.o"
+  "CMakeFiles/blockingqueue_bench2.dir/BlockingQueue_bench2.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/blockingqueue_bench2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/exception_test"
+  "../../../bin/exception_test.pdb"
+  "CMakeFiles/exception_test.dir/Exception_test.cc.o"
+  "CMakeFiles/exception_test.dir/Exception_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/exception_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fileutil_test"
+  "../../../bin/fileutil_test.pdb"
+  "CMakeFiles/fileutil_test.dir/FileUtil_test.cc.o"
+  "CMakeFiles/fileutil_test.dir/FileUtil_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fileutil_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/fork_test"
+  "../../../bin/fork_test.pdb"
+  "CMakeFiles/fork_test.dir/Fork_test.cc.o"
+  "CMakeFiles/fork_test.dir/Fork_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fork_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/gzipfile_test"
+  "../../../bin/gzipfile_test.pdb"
+  "CMakeFiles/gzipfile_test.dir/GzipFile_test.cc.o"
+  "CMakeFiles/gzipfile_test.dir/GzipFile_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/gzipfile_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/logfile_test"
+  "../../../bin/logfile_test.pdb"
+  "CMakeFiles/logfile_test.dir/LogFile_test.cc.o"
+  "CMakeFiles/logfile_test.dir/LogFile_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/logfile_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
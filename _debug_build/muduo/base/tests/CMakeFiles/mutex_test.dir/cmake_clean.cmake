@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/mutex_test"
+  "../../../bin/mutex_test.pdb"
+  "CMakeFiles/mutex_test.dir/Mutex_test.cc.o"
+  "CMakeFiles/mutex_test.dir/Mutex_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mutex_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
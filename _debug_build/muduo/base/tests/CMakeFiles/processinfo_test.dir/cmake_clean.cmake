@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/processinfo_test"
+  "../../../bin/processinfo_test.pdb"
+  "CMakeFiles/processinfo_test.dir/ProcessInfo_test.cc.o"
+  "CMakeFiles/processinfo_test.dir/ProcessInfo_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/processinfo_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/thread_bench"
+  "../../../bin/thread_bench.pdb"
+  "CMakeFiles/thread_bench.dir/Thread_bench.cc.o"
+  "CMakeFiles/thread_bench.dir/Thread_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/threadaffinity_unittest"
+  "../../../bin/threadaffinity_unittest.pdb"
+  "CMakeFiles/threadaffinity_unittest.dir/ThreadAffinity_unittest.cc.o"
+  "CMakeFiles/threadaffinity_unittest.dir/ThreadAffinity_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/threadaffinity_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/timezone_unittest"
+  "../../../bin/timezone_unittest.pdb"
+  "CMakeFiles/timezone_unittest.dir/TimeZone_unittest.cc.o"
+  "CMakeFiles/timezone_unittest.dir/TimeZone_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timezone_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/base/tests
+# Build directory: /root/repo/_debug_build/muduo/base/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(atomic_unittest "/root/repo/_debug_build/bin/atomic_unittest")
+set_tests_properties(atomic_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;5;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(date_unittest "/root/repo/_debug_build/bin/date_unittest")
+set_tests_properties(date_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;22;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(exception_test "/root/repo/_debug_build/bin/exception_test")
+set_tests_properties(exception_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;26;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(fileutil_test "/root/repo/_debug_build/bin/fileutil_test")
+set_tests_properties(fileutil_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;30;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(gzipfile_test "/root/repo/_debug_build/bin/gzipfile_test")
+set_tests_properties(gzipfile_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;38;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(logstream_test "/root/repo/_debug_build/bin/logstream_test")
+set_tests_properties(logstream_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;54;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(threadaffinity_unittest "/root/repo/_debug_build/bin/threadaffinity_unittest")
+set_tests_properties(threadaffinity_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;72;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(timestamp_unittest "/root/repo/_debug_build/bin/timestamp_unittest")
+set_tests_properties(timestamp_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;92;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
+add_test(timezone_unittest "/root/repo/_debug_build/bin/timezone_unittest")
+set_tests_properties(timezone_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/base/tests/CMakeLists.txt;96;add_test;/root/repo/muduo/base/tests/CMakeLists.txt;0;")
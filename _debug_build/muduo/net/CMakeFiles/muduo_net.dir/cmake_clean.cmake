@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "../../lib/libmuduo_net.a"
+  "../../lib/libmuduo_net.pdb"
+  "CMakeFiles/muduo_net.dir/Acceptor.cc.o"
+  "CMakeFiles/muduo_net.dir/Acceptor.cc.o.d"
+  "CMakeFiles/muduo_net.dir/Buffer.cc.o"
+  "CMakeFiles/muduo_net.dir/Buffer.cc.o.d"
+  "CMakeFiles/muduo_net.dir/BufferChain.cc.o"
+  "CMakeFiles/muduo_net.dir/BufferChain.cc.o.d"
+  "CMakeFiles/muduo_net.dir/BufferPool.cc.o"
+  "CMakeFiles/muduo_net.dir/BufferPool.cc.o.d"
+  "CMakeFiles/muduo_net.dir/Channel.cc.o"
+  "CMakeFiles/muduo_net.dir/Channel.cc.o.d"
+  "CMakeFiles/muduo_net.dir/Connector.cc.o"
+  "CMakeFiles/muduo_net.dir/Connector.cc.o.d"
+  "CMakeFiles/muduo_net.dir/EventLoop.cc.o"
+  "CMakeFiles/muduo_net.dir/EventLoop.cc.o.d"
+  "CMakeFiles/muduo_net.dir/EventLoopThread.cc.o"
+  "CMakeFiles/muduo_net.dir/EventLoopThread.cc.o.d"
+  "CMakeFiles/muduo_net.dir/EventLoopThreadPool.cc.o"
+  "CMakeFiles/muduo_net.dir/EventLoopThreadPool.cc.o.d"
+  "CMakeFiles/muduo_net.dir/InetAddress.cc.o"
+  "CMakeFiles/muduo_net.dir/InetAddress.cc.o.d"
+  "CMakeFiles/muduo_net.dir/Poller.cc.o"
+  "CMakeFiles/muduo_net.dir/Poller.cc.o.d"
+  "CMakeFiles/muduo_net.dir/Socket.cc.o"
+  "CMakeFiles/muduo_net.dir/Socket.cc.o.d"
+  "CMakeFiles/muduo_net.dir/SocketsOps.cc.o"
+  "CMakeFiles/muduo_net.dir/SocketsOps.cc.o.d"
+  "CMakeFiles/muduo_net.dir/StringSearch.cc.o"
+  "CMakeFiles/muduo_net.dir/StringSearch.cc.o.d"
+  "CMakeFiles/muduo_net.dir/TcpClient.cc.o"
+  "CMakeFiles/muduo_net.dir/TcpClient.cc.o.d"
+  "CMakeFiles/muduo_net.dir/TcpConnection.cc.o"
+  "CMakeFiles/muduo_net.dir/TcpConnection.cc.o.d"
+  "CMakeFiles/muduo_net.dir/TcpServer.cc.o"
+  "CMakeFiles/muduo_net.dir/TcpServer.cc.o.d"
+  "CMakeFiles/muduo_net.dir/Timer.cc.o"
+  "CMakeFiles/muduo_net.dir/Timer.cc.o.d"
+  "CMakeFiles/muduo_net.dir/TimerQueue.cc.o"
+  "CMakeFiles/muduo_net.dir/TimerQueue.cc.o.d"
+  "CMakeFiles/muduo_net.dir/TimingWheel.cc.o"
+  "CMakeFiles/muduo_net.dir/TimingWheel.cc.o.d"
+  "CMakeFiles/muduo_net.dir/UdpServer.cc.o"
+  "CMakeFiles/muduo_net.dir/UdpServer.cc.o.d"
+  "CMakeFiles/muduo_net.dir/UdpSocket.cc.o"
+  "CMakeFiles/muduo_net.dir/UdpSocket.cc.o.d"
+  "CMakeFiles/muduo_net.dir/poller/DefaultPoller.cc.o"
+  "CMakeFiles/muduo_net.dir/poller/DefaultPoller.cc.o.d"
+  "CMakeFiles/muduo_net.dir/poller/EPollPoller.cc.o"
+  "CMakeFiles/muduo_net.dir/poller/EPollPoller.cc.o.d"
+  "CMakeFiles/muduo_net.dir/poller/IoUringPoller.cc.o"
+  "CMakeFiles/muduo_net.dir/poller/IoUringPoller.cc.o.d"
+  "CMakeFiles/muduo_net.dir/poller/PollPoller.cc.o"
+  "CMakeFiles/muduo_net.dir/poller/PollPoller.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_net.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net
+# Build directory: /root/repo/_debug_build/muduo/net
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("http")
+subdirs("inspect")
+subdirs("tests")
+subdirs("protobuf")
+subdirs("protorpc")
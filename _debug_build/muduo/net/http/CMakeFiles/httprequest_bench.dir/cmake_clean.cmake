@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httprequest_bench"
+  "../../../bin/httprequest_bench.pdb"
+  "CMakeFiles/httprequest_bench.dir/tests/HttpRequest_bench.cc.o"
+  "CMakeFiles/httprequest_bench.dir/tests/HttpRequest_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httprequest_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
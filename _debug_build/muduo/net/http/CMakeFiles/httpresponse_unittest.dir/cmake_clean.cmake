@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/httpresponse_unittest"
+  "../../../bin/httpresponse_unittest.pdb"
+  "CMakeFiles/httpresponse_unittest.dir/tests/HttpResponse_unittest.cc.o"
+  "CMakeFiles/httpresponse_unittest.dir/tests/HttpResponse_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/httpresponse_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libmuduo_http.a"
+  "../../../lib/libmuduo_http.pdb"
+  "CMakeFiles/muduo_http.dir/HttpContext.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpContext.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpRequest.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpRequest.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpResponse.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpResponse.cc.o.d"
+  "CMakeFiles/muduo_http.dir/HttpServer.cc.o"
+  "CMakeFiles/muduo_http.dir/HttpServer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_http.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net/http
+# Build directory: /root/repo/_debug_build/muduo/net/http
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(httprequest_unittest "/root/repo/_debug_build/bin/httprequest_unittest")
+set_tests_properties(httprequest_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;30;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httpresponse_unittest "/root/repo/_debug_build/bin/httpresponse_unittest")
+set_tests_properties(httpresponse_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;34;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httpserver_unittest "/root/repo/_debug_build/bin/httpserver_unittest")
+set_tests_properties(httpserver_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;38;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
+add_test(httpserver_uring_unittest "/root/repo/_debug_build/bin/httpserver_unittest")
+set_tests_properties(httpserver_uring_unittest PROPERTIES  ENVIRONMENT "MUDUO_USE_IO_URING=1" _BACKTRACE_TRIPLES "/root/repo/muduo/net/http/CMakeLists.txt;39;add_test;/root/repo/muduo/net/http/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/inspector_test"
+  "../../../bin/inspector_test.pdb"
+  "CMakeFiles/inspector_test.dir/tests/Inspector_test.cc.o"
+  "CMakeFiles/inspector_test.dir/tests/Inspector_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inspector_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/muduo/net/inspect/Inspector.cc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/Inspector.cc.o" "gcc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/Inspector.cc.o.d"
+  "/root/repo/muduo/net/inspect/LoopInspector.cc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/LoopInspector.cc.o" "gcc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/LoopInspector.cc.o.d"
+  "/root/repo/muduo/net/inspect/PerformanceInspector.cc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/PerformanceInspector.cc.o" "gcc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/PerformanceInspector.cc.o.d"
+  "/root/repo/muduo/net/inspect/ProcessInspector.cc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/ProcessInspector.cc.o" "gcc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/ProcessInspector.cc.o.d"
+  "/root/repo/muduo/net/inspect/SystemInspector.cc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/SystemInspector.cc.o" "gcc" "muduo/net/inspect/CMakeFiles/muduo_inspect.dir/SystemInspector.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/muduo/net/http/CMakeFiles/muduo_http.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/net/CMakeFiles/muduo_net.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/muduo/base/CMakeFiles/muduo_base.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../lib/libmuduo_protobuf_codec.a"
+  "../../../lib/libmuduo_protobuf_codec.pdb"
+  "CMakeFiles/muduo_protobuf_codec.dir/ProtobufCodecLite.cc.o"
+  "CMakeFiles/muduo_protobuf_codec.dir/ProtobufCodecLite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_protobuf_codec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../lib/libmuduo_protorpc.a"
+  "../../../lib/libmuduo_protorpc.pdb"
+  "CMakeFiles/muduo_protorpc.dir/RpcCallTable.cc.o"
+  "CMakeFiles/muduo_protorpc.dir/RpcCallTable.cc.o.d"
+  "CMakeFiles/muduo_protorpc.dir/RpcChannel.cc.o"
+  "CMakeFiles/muduo_protorpc.dir/RpcChannel.cc.o.d"
+  "CMakeFiles/muduo_protorpc.dir/RpcServer.cc.o"
+  "CMakeFiles/muduo_protorpc.dir/RpcServer.cc.o.d"
+  "CMakeFiles/muduo_protorpc.dir/RpcStats.cc.o"
+  "CMakeFiles/muduo_protorpc.dir/RpcStats.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/muduo_protorpc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_rpc_channel_test"
+  "../../../bin/protobuf_rpc_channel_test.pdb"
+  "CMakeFiles/protobuf_rpc_channel_test.dir/RpcChannel_test.cc.o"
+  "CMakeFiles/protobuf_rpc_channel_test.dir/RpcChannel_test.cc.o.d"
+  "CMakeFiles/protobuf_rpc_channel_test.dir/rpcservice.pb.cc.o"
+  "CMakeFiles/protobuf_rpc_channel_test.dir/rpcservice.pb.cc.o.d"
+  "rpcservice.pb.cc"
+  "rpcservice.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_rpc_channel_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
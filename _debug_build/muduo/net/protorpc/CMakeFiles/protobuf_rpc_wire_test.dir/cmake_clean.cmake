@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/protobuf_rpc_wire_test"
+  "../../../bin/protobuf_rpc_wire_test.pdb"
+  "CMakeFiles/protobuf_rpc_wire_test.dir/RpcCodec_test.cc.o"
+  "CMakeFiles/protobuf_rpc_wire_test.dir/RpcCodec_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protobuf_rpc_wire_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net/protorpc
+# Build directory: /root/repo/_debug_build/muduo/net/protorpc
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(protobuf_rpc_calltable_test "/root/repo/_debug_build/bin/protobuf_rpc_calltable_test")
+set_tests_properties(protobuf_rpc_calltable_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/protorpc/CMakeLists.txt;30;add_test;/root/repo/muduo/net/protorpc/CMakeLists.txt;0;")
+add_test(protobuf_rpc_channel_test "/root/repo/_debug_build/bin/protobuf_rpc_channel_test")
+set_tests_properties(protobuf_rpc_channel_test PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/protorpc/CMakeLists.txt;42;add_test;/root/repo/muduo/net/protorpc/CMakeLists.txt;0;")
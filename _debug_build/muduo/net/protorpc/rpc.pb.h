@@ -0,0 +1,782 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: rpc.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_rpc_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_rpc_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_rpc_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_rpc_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rpc_2eproto;
+namespace muduo {
+namespace net {
+class RpcMessage;
+struct RpcMessageDefaultTypeInternal;
+extern RpcMessageDefaultTypeInternal _RpcMessage_default_instance_;
+}  // namespace net
+}  // namespace muduo
+PROTOBUF_NAMESPACE_OPEN
+template<> ::muduo::net::RpcMessage* Arena::CreateMaybeMessage<::muduo::net::RpcMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace muduo {
+namespace net {
+
+enum MessageType : int {
+  REQUEST = 1,
+  RESPONSE = 2,
+  ERROR = 3
+};
+bool MessageType_IsValid(int value);
+constexpr MessageType MessageType_MIN = REQUEST;
+constexpr MessageType MessageType_MAX = ERROR;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
+}
+inline bool MessageType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
+    MessageType_descriptor(), name, value);
+}
+enum ErrorCode : int {
+  NO_ERROR = 0,
+  WRONG_PROTO = 1,
+  NO_SERVICE = 2,
+  NO_METHOD = 3,
+  INVALID_REQUEST = 4,
+  INVALID_RESPONSE = 5,
+  TIMEOUT = 6
+};
+bool ErrorCode_IsValid(int value);
+constexpr ErrorCode ErrorCode_MIN = NO_ERROR;
+constexpr ErrorCode ErrorCode_MAX = TIMEOUT;
+constexpr int ErrorCode_ARRAYSIZE = ErrorCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ErrorCode_descriptor();
+template<typename T>
+inline const std::string& ErrorCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ErrorCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ErrorCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ErrorCode_descriptor(), enum_t_value);
+}
+inline bool ErrorCode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ErrorCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ErrorCode>(
+    ErrorCode_descriptor(), name, value);
+}
+// ===================================================================
+
+class RpcMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:muduo.net.RpcMessage) */ {
+ public:
+  inline RpcMessage() : RpcMessage(nullptr) {}
+  ~RpcMessage() override;
+  explicit PROTOBUF_CONSTEXPR RpcMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RpcMessage(const RpcMessage& from);
+  RpcMessage(RpcMessage&& from) noexcept
+    : RpcMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline RpcMessage& operator=(const RpcMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RpcMessage& operator=(RpcMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RpcMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RpcMessage* internal_default_instance() {
+    return reinterpret_cast<const RpcMessage*>(
+               &_RpcMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RpcMessage& a, RpcMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RpcMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RpcMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RpcMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RpcMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RpcMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RpcMessage& from) {
+    RpcMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RpcMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "muduo.net.RpcMessage";
+  }
+  protected:
+  explicit RpcMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceFieldNumber = 3,
+    kMethodFieldNumber = 4,
+    kRequestFieldNumber = 5,
+    kResponseFieldNumber = 6,
+    kIdFieldNumber = 2,
+    kErrorFieldNumber = 7,
+    kTypeFieldNumber = 1,
+  };
+  // optional string service = 3;
+  bool has_service() const;
+  private:
+  bool _internal_has_service() const;
+  public:
+  void clear_service();
+  const std::string& service() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service();
+  PROTOBUF_NODISCARD std::string* release_service();
+  void set_allocated_service(std::string* service);
+  private:
+  const std::string& _internal_service() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service(const std::string& value);
+  std::string* _internal_mutable_service();
+  public:
+
+  // optional string method = 4;
+  bool has_method() const;
+  private:
+  bool _internal_has_method() const;
+  public:
+  void clear_method();
+  const std::string& method() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method();
+  PROTOBUF_NODISCARD std::string* release_method();
+  void set_allocated_method(std::string* method);
+  private:
+  const std::string& _internal_method() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method(const std::string& value);
+  std::string* _internal_mutable_method();
+  public:
+
+  // optional bytes request = 5;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const std::string& request() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_request();
+  PROTOBUF_NODISCARD std::string* release_request();
+  void set_allocated_request(std::string* request);
+  private:
+  const std::string& _internal_request() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request(const std::string& value);
+  std::string* _internal_mutable_request();
+  public:
+
+  // optional bytes response = 6;
+  bool has_response() const;
+  private:
+  bool _internal_has_response() const;
+  public:
+  void clear_response();
+  const std::string& response() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_response(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_response();
+  PROTOBUF_NODISCARD std::string* release_response();
+  void set_allocated_response(std::string* response);
+  private:
+  const std::string& _internal_response() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_response(const std::string& value);
+  std::string* _internal_mutable_response();
+  public:
+
+  // required fixed64 id = 2;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // optional .muduo.net.ErrorCode error = 7;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  ::muduo::net::ErrorCode error() const;
+  void set_error(::muduo::net::ErrorCode value);
+  private:
+  ::muduo::net::ErrorCode _internal_error() const;
+  void _internal_set_error(::muduo::net::ErrorCode value);
+  public:
+
+  // required .muduo.net.MessageType type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::muduo::net::MessageType type() const;
+  void set_type(::muduo::net::MessageType value);
+  private:
+  ::muduo::net::MessageType _internal_type() const;
+  void _internal_set_type(::muduo::net::MessageType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:muduo.net.RpcMessage)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr response_;
+    uint64_t id_;
+    int error_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_rpc_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RpcMessage
+
+// required .muduo.net.MessageType type = 1;
+inline bool RpcMessage::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool RpcMessage::has_type() const {
+  return _internal_has_type();
+}
+inline void RpcMessage::clear_type() {
+  _impl_.type_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::muduo::net::MessageType RpcMessage::_internal_type() const {
+  return static_cast< ::muduo::net::MessageType >(_impl_.type_);
+}
+inline ::muduo::net::MessageType RpcMessage::type() const {
+  // @@protoc_insertion_point(field_get:muduo.net.RpcMessage.type)
+  return _internal_type();
+}
+inline void RpcMessage::_internal_set_type(::muduo::net::MessageType value) {
+  assert(::muduo::net::MessageType_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.type_ = value;
+}
+inline void RpcMessage::set_type(::muduo::net::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:muduo.net.RpcMessage.type)
+}
+
+// required fixed64 id = 2;
+inline bool RpcMessage::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool RpcMessage::has_id() const {
+  return _internal_has_id();
+}
+inline void RpcMessage::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t RpcMessage::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t RpcMessage::id() const {
+  // @@protoc_insertion_point(field_get:muduo.net.RpcMessage.id)
+  return _internal_id();
+}
+inline void RpcMessage::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.id_ = value;
+}
+inline void RpcMessage::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:muduo.net.RpcMessage.id)
+}
+
+// optional string service = 3;
+inline bool RpcMessage::_internal_has_service() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RpcMessage::has_service() const {
+  return _internal_has_service();
+}
+inline void RpcMessage::clear_service() {
+  _impl_.service_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& RpcMessage::service() const {
+  // @@protoc_insertion_point(field_get:muduo.net.RpcMessage.service)
+  return _internal_service();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcMessage::set_service(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:muduo.net.RpcMessage.service)
+}
+inline std::string* RpcMessage::mutable_service() {
+  std::string* _s = _internal_mutable_service();
+  // @@protoc_insertion_point(field_mutable:muduo.net.RpcMessage.service)
+  return _s;
+}
+inline const std::string& RpcMessage::_internal_service() const {
+  return _impl_.service_.Get();
+}
+inline void RpcMessage::_internal_set_service(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcMessage::_internal_mutable_service() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcMessage::release_service() {
+  // @@protoc_insertion_point(field_release:muduo.net.RpcMessage.service)
+  if (!_internal_has_service()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_.IsDefault()) {
+    _impl_.service_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RpcMessage::set_allocated_service(std::string* service) {
+  if (service != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_.SetAllocated(service, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_.IsDefault()) {
+    _impl_.service_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:muduo.net.RpcMessage.service)
+}
+
+// optional string method = 4;
+inline bool RpcMessage::_internal_has_method() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RpcMessage::has_method() const {
+  return _internal_has_method();
+}
+inline void RpcMessage::clear_method() {
+  _impl_.method_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& RpcMessage::method() const {
+  // @@protoc_insertion_point(field_get:muduo.net.RpcMessage.method)
+  return _internal_method();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcMessage::set_method(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.method_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:muduo.net.RpcMessage.method)
+}
+inline std::string* RpcMessage::mutable_method() {
+  std::string* _s = _internal_mutable_method();
+  // @@protoc_insertion_point(field_mutable:muduo.net.RpcMessage.method)
+  return _s;
+}
+inline const std::string& RpcMessage::_internal_method() const {
+  return _impl_.method_.Get();
+}
+inline void RpcMessage::_internal_set_method(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.method_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcMessage::_internal_mutable_method() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.method_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcMessage::release_method() {
+  // @@protoc_insertion_point(field_release:muduo.net.RpcMessage.method)
+  if (!_internal_has_method()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.method_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_.IsDefault()) {
+    _impl_.method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RpcMessage::set_allocated_method(std::string* method) {
+  if (method != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.method_.SetAllocated(method, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_.IsDefault()) {
+    _impl_.method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:muduo.net.RpcMessage.method)
+}
+
+// optional bytes request = 5;
+inline bool RpcMessage::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RpcMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void RpcMessage::clear_request() {
+  _impl_.request_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& RpcMessage::request() const {
+  // @@protoc_insertion_point(field_get:muduo.net.RpcMessage.request)
+  return _internal_request();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcMessage::set_request(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.request_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:muduo.net.RpcMessage.request)
+}
+inline std::string* RpcMessage::mutable_request() {
+  std::string* _s = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:muduo.net.RpcMessage.request)
+  return _s;
+}
+inline const std::string& RpcMessage::_internal_request() const {
+  return _impl_.request_.Get();
+}
+inline void RpcMessage::_internal_set_request(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.request_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcMessage::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.request_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcMessage::release_request() {
+  // @@protoc_insertion_point(field_release:muduo.net.RpcMessage.request)
+  if (!_internal_has_request()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.request_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_.IsDefault()) {
+    _impl_.request_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RpcMessage::set_allocated_request(std::string* request) {
+  if (request != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.request_.SetAllocated(request, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_.IsDefault()) {
+    _impl_.request_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:muduo.net.RpcMessage.request)
+}
+
+// optional bytes response = 6;
+inline bool RpcMessage::_internal_has_response() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool RpcMessage::has_response() const {
+  return _internal_has_response();
+}
+inline void RpcMessage::clear_response() {
+  _impl_.response_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& RpcMessage::response() const {
+  // @@protoc_insertion_point(field_get:muduo.net.RpcMessage.response)
+  return _internal_response();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RpcMessage::set_response(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.response_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:muduo.net.RpcMessage.response)
+}
+inline std::string* RpcMessage::mutable_response() {
+  std::string* _s = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:muduo.net.RpcMessage.response)
+  return _s;
+}
+inline const std::string& RpcMessage::_internal_response() const {
+  return _impl_.response_.Get();
+}
+inline void RpcMessage::_internal_set_response(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.response_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RpcMessage::_internal_mutable_response() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.response_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RpcMessage::release_response() {
+  // @@protoc_insertion_point(field_release:muduo.net.RpcMessage.response)
+  if (!_internal_has_response()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.response_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.response_.IsDefault()) {
+    _impl_.response_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void RpcMessage::set_allocated_response(std::string* response) {
+  if (response != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.response_.SetAllocated(response, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.response_.IsDefault()) {
+    _impl_.response_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:muduo.net.RpcMessage.response)
+}
+
+// optional .muduo.net.ErrorCode error = 7;
+inline bool RpcMessage::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool RpcMessage::has_error() const {
+  return _internal_has_error();
+}
+inline void RpcMessage::clear_error() {
+  _impl_.error_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::muduo::net::ErrorCode RpcMessage::_internal_error() const {
+  return static_cast< ::muduo::net::ErrorCode >(_impl_.error_);
+}
+inline ::muduo::net::ErrorCode RpcMessage::error() const {
+  // @@protoc_insertion_point(field_get:muduo.net.RpcMessage.error)
+  return _internal_error();
+}
+inline void RpcMessage::_internal_set_error(::muduo::net::ErrorCode value) {
+  assert(::muduo::net::ErrorCode_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.error_ = value;
+}
+inline void RpcMessage::set_error(::muduo::net::ErrorCode value) {
+  _internal_set_error(value);
+  // @@protoc_insertion_point(field_set:muduo.net.RpcMessage.error)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace net
+}  // namespace muduo
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::muduo::net::MessageType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::muduo::net::MessageType>() {
+  return ::muduo::net::MessageType_descriptor();
+}
+template <> struct is_proto_enum< ::muduo::net::ErrorCode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::muduo::net::ErrorCode>() {
+  return ::muduo::net::ErrorCode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_rpc_2eproto
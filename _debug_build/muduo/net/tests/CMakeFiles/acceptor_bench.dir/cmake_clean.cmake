@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/acceptor_bench"
+  "../../../bin/acceptor_bench.pdb"
+  "CMakeFiles/acceptor_bench.dir/Acceptor_bench.cc.o"
+  "CMakeFiles/acceptor_bench.dir/Acceptor_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/acceptor_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
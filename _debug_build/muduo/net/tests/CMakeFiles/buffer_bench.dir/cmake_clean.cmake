@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/buffer_bench"
+  "../../../bin/buffer_bench.pdb"
+  "CMakeFiles/buffer_bench.dir/Buffer_bench.cc.o"
+  "CMakeFiles/buffer_bench.dir/Buffer_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/buffer_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bufferchain_unittest"
+  "../../../bin/bufferchain_unittest.pdb"
+  "CMakeFiles/bufferchain_unittest.dir/BufferChain_unittest.cc.o"
+  "CMakeFiles/bufferchain_unittest.dir/BufferChain_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bufferchain_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
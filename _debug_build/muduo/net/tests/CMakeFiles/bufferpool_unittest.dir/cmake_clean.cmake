@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/bufferpool_unittest"
+  "../../../bin/bufferpool_unittest.pdb"
+  "CMakeFiles/bufferpool_unittest.dir/BufferPool_unittest.cc.o"
+  "CMakeFiles/bufferpool_unittest.dir/BufferPool_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bufferpool_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
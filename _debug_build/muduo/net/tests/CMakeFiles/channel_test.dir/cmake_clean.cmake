@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/channel_test"
+  "../../../bin/channel_test.pdb"
+  "CMakeFiles/channel_test.dir/Channel_test.cc.o"
+  "CMakeFiles/channel_test.dir/Channel_test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/channel_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
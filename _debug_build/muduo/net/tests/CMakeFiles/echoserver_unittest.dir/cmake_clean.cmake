@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/echoserver_unittest"
+  "../../../bin/echoserver_unittest.pdb"
+  "CMakeFiles/echoserver_unittest.dir/EchoServer_unittest.cc.o"
+  "CMakeFiles/echoserver_unittest.dir/EchoServer_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/echoserver_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/eventloop_bench"
+  "../../../bin/eventloop_bench.pdb"
+  "CMakeFiles/eventloop_bench.dir/EventLoop_bench.cc.o"
+  "CMakeFiles/eventloop_bench.dir/EventLoop_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eventloop_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/eventloop_unittest"
+  "../../../bin/eventloop_unittest.pdb"
+  "CMakeFiles/eventloop_unittest.dir/EventLoop_unittest.cc.o"
+  "CMakeFiles/eventloop_unittest.dir/EventLoop_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eventloop_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/eventloopthreadpool_unittest"
+  "../../../bin/eventloopthreadpool_unittest.pdb"
+  "CMakeFiles/eventloopthreadpool_unittest.dir/EventLoopThreadPool_unittest.cc.o"
+  "CMakeFiles/eventloopthreadpool_unittest.dir/EventLoopThreadPool_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/eventloopthreadpool_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tcpclient_reg2"
+  "../../../bin/tcpclient_reg2.pdb"
+  "CMakeFiles/tcpclient_reg2.dir/TcpClient_reg2.cc.o"
+  "CMakeFiles/tcpclient_reg2.dir/TcpClient_reg2.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcpclient_reg2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
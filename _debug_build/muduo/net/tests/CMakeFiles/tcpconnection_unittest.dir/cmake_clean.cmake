@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/tcpconnection_unittest"
+  "../../../bin/tcpconnection_unittest.pdb"
+  "CMakeFiles/tcpconnection_unittest.dir/TcpConnection_unittest.cc.o"
+  "CMakeFiles/tcpconnection_unittest.dir/TcpConnection_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcpconnection_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
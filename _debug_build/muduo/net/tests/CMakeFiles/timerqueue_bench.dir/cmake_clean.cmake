@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/timerqueue_bench"
+  "../../../bin/timerqueue_bench.pdb"
+  "CMakeFiles/timerqueue_bench.dir/TimerQueue_bench.cc.o"
+  "CMakeFiles/timerqueue_bench.dir/TimerQueue_bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timerqueue_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
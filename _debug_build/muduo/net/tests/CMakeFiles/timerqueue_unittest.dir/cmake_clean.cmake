@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/timerqueue_unittest"
+  "../../../bin/timerqueue_unittest.pdb"
+  "CMakeFiles/timerqueue_unittest.dir/TimerQueue_unittest.cc.o"
+  "CMakeFiles/timerqueue_unittest.dir/TimerQueue_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timerqueue_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
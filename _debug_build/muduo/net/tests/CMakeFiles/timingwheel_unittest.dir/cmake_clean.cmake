@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/timingwheel_unittest"
+  "../../../bin/timingwheel_unittest.pdb"
+  "CMakeFiles/timingwheel_unittest.dir/TimingWheel_unittest.cc.o"
+  "CMakeFiles/timingwheel_unittest.dir/TimingWheel_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timingwheel_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
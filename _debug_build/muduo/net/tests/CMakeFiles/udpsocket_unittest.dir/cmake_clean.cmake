@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../bin/udpsocket_unittest"
+  "../../../bin/udpsocket_unittest.pdb"
+  "CMakeFiles/udpsocket_unittest.dir/UdpSocket_unittest.cc.o"
+  "CMakeFiles/udpsocket_unittest.dir/UdpSocket_unittest.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udpsocket_unittest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
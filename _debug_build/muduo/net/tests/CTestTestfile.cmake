@@ -0,0 +1,26 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/muduo/net/tests
+# Build directory: /root/repo/_debug_build/muduo/net/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(buffer_unittest "/root/repo/_debug_build/bin/buffer_unittest")
+set_tests_properties(buffer_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;31;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(bufferchain_unittest "/root/repo/_debug_build/bin/bufferchain_unittest")
+set_tests_properties(bufferchain_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;35;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(bufferpool_unittest "/root/repo/_debug_build/bin/bufferpool_unittest")
+set_tests_properties(bufferpool_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;39;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(timingwheel_unittest "/root/repo/_debug_build/bin/timingwheel_unittest")
+set_tests_properties(timingwheel_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;43;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(inetaddress_unittest "/root/repo/_debug_build/bin/inetaddress_unittest")
+set_tests_properties(inetaddress_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;47;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(udpsocket_unittest "/root/repo/_debug_build/bin/udpsocket_unittest")
+set_tests_properties(udpsocket_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;51;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(tcpconnection_unittest "/root/repo/_debug_build/bin/tcpconnection_unittest")
+set_tests_properties(tcpconnection_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;55;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(tcpconnection_uring_unittest "/root/repo/_debug_build/bin/tcpconnection_unittest")
+set_tests_properties(tcpconnection_uring_unittest PROPERTIES  ENVIRONMENT "MUDUO_USE_IO_URING=1" _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;56;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(timerqueue_unittest "/root/repo/_debug_build/bin/timerqueue_unittest")
+set_tests_properties(timerqueue_unittest PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;78;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
+add_test(timerqueue_wheel_unittest "/root/repo/_debug_build/bin/timerqueue_unittest")
+set_tests_properties(timerqueue_wheel_unittest PROPERTIES  ENVIRONMENT "MUDUO_USE_TIMING_WHEEL=1" _BACKTRACE_TRIPLES "/root/repo/muduo/net/tests/CMakeLists.txt;79;add_test;/root/repo/muduo/net/tests/CMakeLists.txt;0;")
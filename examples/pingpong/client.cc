@@ -9,6 +9,7 @@
 #include <utility>
 
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 
 using namespace muduo;
@@ -16,6 +17,9 @@ using namespace muduo::net;
 
 class Client;
 
+const size_t kZeroCopyThreshold = 16 * 1024;
+bool g_zeroCopy = false;
+
 class Session : noncopyable
 {
  public:
@@ -64,7 +68,14 @@ class Session : noncopyable
     ++messagesRead_;
     bytesRead_ += buf->readableBytes();
     bytesWritten_ += buf->readableBytes();
-    conn->send(buf);
+    if (g_zeroCopy)
+    {
+      conn->send(std::move(*buf));
+    }
+    else
+    {
+      conn->send(buf);
+    }
   }
 
   TcpClient client_;
@@ -176,6 +187,10 @@ void Session::onConnection(const TcpConnectionPtr& conn)
   if (conn->connected())
   {
     conn->setTcpNoDelay(true);
+    if (g_zeroCopy)
+    {
+      conn->setZeroCopyThreshold(kZeroCopyThreshold);
+    }
     conn->send(owner_->message());
     owner_->onConnect();
   }
@@ -187,10 +202,10 @@ void Session::onConnection(const TcpConnectionPtr& conn)
 
 int main(int argc, char* argv[])
 {
-  if (argc != 7)
+  if (argc != 7 && argc != 8)
   {
     fprintf(stderr, "Usage: client <host_ip> <port> <threads> <blocksize> ");
-    fprintf(stderr, "<sessions> <time>\n");
+    fprintf(stderr, "<sessions> <time> [zerocopy]\n");
   }
   else
   {
@@ -203,6 +218,7 @@ int main(int argc, char* argv[])
     int blockSize = atoi(argv[4]);
     int sessionCount = atoi(argv[5]);
     int timeout = atoi(argv[6]);
+    g_zeroCopy = argc > 7 && strcmp(argv[7], "zerocopy") == 0;
 
     EventLoop loop;
     InetAddress serverAddr(ip, port);
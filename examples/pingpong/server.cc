@@ -9,29 +9,45 @@
 #include <utility>
 
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 
 using namespace muduo;
 using namespace muduo::net;
 
+const size_t kZeroCopyThreshold = 16 * 1024;
+bool g_zeroCopy = false;
+
 void onConnection(const TcpConnectionPtr& conn)
 {
   if (conn->connected())
   {
     conn->setTcpNoDelay(true);
+    if (g_zeroCopy)
+    {
+      conn->setZeroCopyThreshold(kZeroCopyThreshold);
+    }
   }
 }
 
 void onMessage(const TcpConnectionPtr& conn, Buffer* buf, Timestamp)
 {
-  conn->send(buf);
+  if (g_zeroCopy)
+  {
+    // hands the storage over, input buffer gets a new one for next read
+    conn->send(std::move(*buf));
+  }
+  else
+  {
+    conn->send(buf);
+  }
 }
 
 int main(int argc, char* argv[])
 {
   if (argc < 4)
   {
-    fprintf(stderr, "Usage: server <address> <port> <threads>\n");
+    fprintf(stderr, "Usage: server <address> <port> <threads> [et] [reuseport] [zerocopy]\n");
   }
   else
   {
@@ -42,13 +58,25 @@ int main(int argc, char* argv[])
     uint16_t port = static_cast<uint16_t>(atoi(argv[2]));
     InetAddress listenAddr(ip, port);
     int threadCount = atoi(argv[3]);
+    bool edgeTriggered = false;
+    TcpServer::Option option = TcpServer::kNoReusePort;
+    for (int i = 4; i < argc; ++i)
+    {
+      if (strcmp(argv[i], "et") == 0)
+        edgeTriggered = true;
+      else if (strcmp(argv[i], "reuseport") == 0)
+        option = TcpServer::kReusePortPerLoop;
+      else if (strcmp(argv[i], "zerocopy") == 0)
+        g_zeroCopy = true;
+    }
 
     EventLoop loop;
 
-    TcpServer server(&loop, listenAddr, "PingPong");
+    TcpServer server(&loop, listenAddr, "PingPong", option);
 
     server.setConnectionCallback(onConnection);
     server.setMessageCallback(onMessage);
+    server.setEdgeTriggered(edgeTriggered);
 
     if (threadCount > 1)
     {
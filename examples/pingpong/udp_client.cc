@@ -0,0 +1,214 @@
+#include "muduo/net/UdpSocket.h"
+
+#include "muduo/base/Atomic.h"
+#include "muduo/base/Logging.h"
+#include "muduo/base/Thread.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThreadPool.h"
+#include "muduo/net/InetAddress.h"
+
+#include <memory>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+// datagrams in flight per session, like the pipelined stream of pingpong
+const int kWindow = 16;
+
+class Client;
+
+class Session : noncopyable
+{
+ public:
+  Session(EventLoop* loop,
+          const InetAddress& serverAddr,
+          int batchSize,
+          Client* owner)
+    : socket_(loop, InetAddress(0, false, serverAddr.family() == AF_INET6),
+              false, batchSize, 65536),
+      serverAddr_(serverAddr),
+      owner_(owner),
+      stopped_(false),
+      bytesRead_(0),
+      messagesRead_(0)
+  {
+    socket_.setBatchCallback(
+        std::bind(&Session::onBatch, this, _1, _2, _3, std::placeholders::_4));
+  }
+
+  EventLoop* getLoop() const { return socket_.getLoop(); }
+
+  void start(const string& message)
+  {
+    socket_.start();
+    for (int i = 0; i < kWindow; ++i)
+    {
+      socket_.sendTo(message, serverAddr_);
+    }
+  }
+
+  void stop();
+
+  int64_t bytesRead() const { return bytesRead_; }
+  int64_t messagesRead() const { return messagesRead_; }
+  int64_t recvCalls() const { return socket_.recvCalls(); }
+  int64_t sendCalls() const { return socket_.sendCalls(); }
+
+ private:
+  void onBatch(UdpSocket* socket, const Datagram* datagrams, int count, Timestamp)
+  {
+    if (stopped_)
+    {
+      return;
+    }
+    for (int i = 0; i < count; ++i)
+    {
+      ++messagesRead_;
+      bytesRead_ += datagrams[i].length;
+      socket->sendTo(StringPiece(datagrams[i].data, static_cast<int>(datagrams[i].length)),
+                     serverAddr_);
+    }
+  }
+
+  UdpSocket socket_;
+  const InetAddress serverAddr_;
+  Client* owner_;
+  bool stopped_;
+  int64_t bytesRead_;
+  int64_t messagesRead_;
+};
+
+class Client : noncopyable
+{
+ public:
+  Client(EventLoop* loop,
+         const InetAddress& serverAddr,
+         int blockSize,
+         int sessionCount,
+         int timeout,
+         int threadCount,
+         int batchSize)
+    : loop_(loop),
+      threadPool_(loop, "pingpong-udp-client"),
+      timeout_(timeout)
+  {
+    loop->runAfter(timeout, std::bind(&Client::handleTimeout, this));
+    if (threadCount > 1)
+    {
+      threadPool_.setThreadNum(threadCount);
+    }
+    threadPool_.start();
+
+    for (int i = 0; i < blockSize; ++i)
+    {
+      message_.push_back(static_cast<char>(i % 128));
+    }
+
+    for (int i = 0; i < sessionCount; ++i)
+    {
+      Session* session = new Session(threadPool_.getNextLoop(), serverAddr, batchSize, this);
+      session->getLoop()->runInLoop(std::bind(&Session::start, session, message_));
+      sessions_.emplace_back(session);
+    }
+    numRunning_.getAndSet(sessionCount);
+  }
+
+  void onStop()
+  {
+    if (numRunning_.decrementAndGet() == 0)
+    {
+      loop_->queueInLoop(std::bind(&Client::report, this));
+    }
+  }
+
+ private:
+  void handleTimeout()
+  {
+    LOG_WARN << "stop";
+    for (auto& session : sessions_)
+    {
+      session->getLoop()->runInLoop(std::bind(&Session::stop, session.get()));
+    }
+  }
+
+  void report()
+  {
+    int64_t totalBytesRead = 0;
+    int64_t totalMessagesRead = 0;
+    int64_t totalRecvCalls = 0;
+    int64_t totalSendCalls = 0;
+    for (const auto& session : sessions_)
+    {
+      totalBytesRead += session->bytesRead();
+      totalMessagesRead += session->messagesRead();
+      totalRecvCalls += session->recvCalls();
+      totalSendCalls += session->sendCalls();
+    }
+    LOG_WARN << totalBytesRead << " total bytes read";
+    LOG_WARN << totalMessagesRead << " total datagrams read";
+    LOG_WARN << static_cast<double>(totalMessagesRead) / timeout_ << " datagrams/s";
+    LOG_WARN << static_cast<double>(totalBytesRead) / (timeout_ * 1024 * 1024)
+             << " MiB/s throughput";
+    LOG_WARN << static_cast<double>(totalMessagesRead) / static_cast<double>(totalRecvCalls)
+             << " datagrams per recvmmsg, "
+             << static_cast<double>(totalMessagesRead) / static_cast<double>(totalSendCalls)
+             << " per sendmmsg";
+    // sessions must be destroyed in their loops
+    for (auto& session : sessions_)
+    {
+      session->getLoop()->runInLoop(std::bind(&Client::destroy, session.release()));
+    }
+    loop_->quit();
+  }
+
+  static void destroy(Session* session)
+  {
+    delete session;
+  }
+
+  EventLoop* loop_;
+  EventLoopThreadPool threadPool_;
+  int timeout_;
+  std::vector<std::unique_ptr<Session>> sessions_;
+  string message_;
+  AtomicInt32 numRunning_;
+};
+
+void Session::stop()
+{
+  stopped_ = true;
+  owner_->onStop();
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 7 && argc != 8)
+  {
+    fprintf(stderr, "Usage: udp_client <host_ip> <port> <threads> <blocksize> ");
+    fprintf(stderr, "<sessions> <time> [batch]\n");
+  }
+  else
+  {
+    LOG_INFO << "pid = " << getpid() << ", tid = " << CurrentThread::tid();
+    Logger::setLogLevel(Logger::WARN);
+
+    const char* ip = argv[1];
+    uint16_t port = static_cast<uint16_t>(atoi(argv[2]));
+    int threadCount = atoi(argv[3]);
+    int blockSize = atoi(argv[4]);
+    int sessionCount = atoi(argv[5]);
+    int timeout = atoi(argv[6]);
+    int batchSize = argc > 7 ? atoi(argv[7]) : UdpSocket::kDefaultBatchSize;
+
+    EventLoop loop;
+    InetAddress serverAddr(ip, port);
+
+    Client client(&loop, serverAddr, blockSize, sessionCount, timeout, threadCount, batchSize);
+    loop.loop();
+  }
+}
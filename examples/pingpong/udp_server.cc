@@ -0,0 +1,63 @@
+#include "muduo/net/UdpServer.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/base/Thread.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/InetAddress.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+void onBatch(UdpSocket* socket, const Datagram* datagrams, int count, Timestamp)
+{
+  for (int i = 0; i < count; ++i)
+  {
+    socket->sendTo(StringPiece(datagrams[i].data, static_cast<int>(datagrams[i].length)),
+                   datagrams[i].peer);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 4)
+  {
+    fprintf(stderr, "Usage: udp_server <address> <port> <threads> [batch] [reuseport]\n");
+  }
+  else
+  {
+    LOG_INFO << "pid = " << getpid() << ", tid = " << CurrentThread::tid();
+    Logger::setLogLevel(Logger::WARN);
+
+    const char* ip = argv[1];
+    uint16_t port = static_cast<uint16_t>(atoi(argv[2]));
+    InetAddress listenAddr(ip, port);
+    int threadCount = atoi(argv[3]);
+    int batchSize = argc > 4 ? atoi(argv[4]) : UdpSocket::kDefaultBatchSize;
+    UdpServer::Option option = UdpServer::kNoReusePort;
+    if (argc > 5 && strcmp(argv[5], "reuseport") == 0)
+    {
+      option = UdpServer::kReusePort;
+    }
+
+    EventLoop loop;
+
+    UdpServer server(&loop, listenAddr, "PingPongUdp", option);
+
+    server.setBatchCallback(onBatch);
+    server.setBatchSize(batchSize, 65536);
+
+    if (threadCount > 1)
+    {
+      server.setThreadNum(threadCount);
+    }
+
+    server.start();
+
+    loop.loop();
+  }
+}
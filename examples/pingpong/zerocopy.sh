@@ -0,0 +1,23 @@
+#!/bin/sh
+
+# Compares copy and MSG_ZEROCOPY sends of pingpong at 64KiB to 1MiB blocks.
+# Usage: zerocopy.sh [bin_dir] [seconds]
+# Over loopback the kernel always copies, run it between two hosts to see the gain.
+
+bin=${1:-../../build/release-cpp11/bin}
+seconds=${2:-10}
+killall pingpong_server 2>/dev/null
+
+for mode in copy zerocopy
+do
+  for block in 65536 262144 1048576
+  do
+    echo "==== $mode $block"
+    $bin/pingpong_server 0.0.0.0 33333 1 $mode &
+    srvpid=$!
+    sleep 1
+    $bin/pingpong_client 127.0.0.1 33333 1 $block 10 $seconds $mode
+    kill -9 $srvpid
+    sleep 1
+  done
+done
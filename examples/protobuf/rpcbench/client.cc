@@ -3,19 +3,37 @@
 #include "muduo/base/CountDownLatch.h"
 #include "muduo/base/Logging.h"
 #include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
 #include "muduo/net/EventLoopThreadPool.h"
 #include "muduo/net/InetAddress.h"
 #include "muduo/net/TcpClient.h"
 #include "muduo/net/TcpConnection.h"
+#include "muduo/net/inspect/Inspector.h"
 #include "muduo/net/protorpc/RpcChannel.h"
+#include "muduo/net/protorpc/RpcStats.h"
+#include "muduo/net/protorpc/rpc.pb.h"
 
+#include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
 using namespace muduo;
 using namespace muduo::net;
 
 static const int kRequests = 50000;
+static string g_payload = "001010";
+static bool g_inPlaceFraming = true;
+
+// user + sys seconds of this process
+static double cpuTime()
+{
+  struct rusage usage;
+  ::getrusage(RUSAGE_SELF, &usage);
+  return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+      + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
 
 class RpcClient : noncopyable
 {
@@ -37,6 +55,7 @@ class RpcClient : noncopyable
         std::bind(&RpcClient::onConnection, this, _1));
     client_.setMessageCallback(
         std::bind(&RpcChannel::onMessage, get_pointer(channel_), _1, _2, _3));
+    channel_->setInPlaceFraming(g_inPlaceFraming);
     // client_.enableRetry();
   }
 
@@ -48,7 +67,7 @@ class RpcClient : noncopyable
   void sendRequest()
   {
     echo::EchoRequest request;
-    request.set_payload("001010");
+    request.set_payload(g_payload);
     echo::EchoResponse* response = new echo::EchoResponse;
     stub_.Echo(NULL, &request, response, NewCallback(this, &RpcClient::replied, response));
   }
@@ -90,10 +109,66 @@ class RpcClient : noncopyable
   int count_;
 };
 
+// encodes and decodes a request in-process, as both ends of a call do
+void benchFraming(int payloadBytes)
+{
+  const int kRounds = 200000;
+  echo::EchoRequest request;
+  request.set_payload(string(payloadBytes, 'x'));
+  RpcMessage header;
+  header.set_type(REQUEST);
+  header.set_id(1);
+  header.set_service(echo::EchoService::descriptor()->full_name());
+  header.set_method("Echo");
+  RpcCodec codec(RpcCodec::ProtobufMessageCallback(NULL));
+  ProtobufCodecLite lite(&RpcMessage::default_instance(), rpctag,
+                         ProtobufCodecLite::ProtobufMessageCallback());
+
+  for (int inPlace = 0; inPlace < 2; ++inPlace)
+  {
+    int64_t checksum = 0;
+    double cpuStart = cpuTime();
+    for (int i = 0; i < kRounds; ++i)
+    {
+      Buffer buf;
+      echo::EchoRequest received;
+      if (inPlace)
+      {
+        fillRpcFrame(&buf, header, request);
+        RpcMessage parsed;
+        StringPiece payload;
+        StringPiece frame(buf.peek() + ProtobufCodecLite::kHeaderLen,
+                          static_cast<int>(buf.readableBytes()) - ProtobufCodecLite::kHeaderLen);
+        parseRpcFrame(frame, &parsed, &payload);
+        received.ParseFromArray(payload.data(), payload.size());
+      }
+      else
+      {
+        RpcMessage message(header);
+        message.set_request(request.SerializeAsString());
+        codec.fillEmptyBuffer(&buf, message);
+        RpcMessage parsed;
+        lite.parse(buf.peek() + ProtobufCodecLite::kHeaderLen,
+                   static_cast<int>(buf.readableBytes()) - ProtobufCodecLite::kHeaderLen,
+                   &parsed);
+        received.ParseFromString(parsed.request());
+      }
+      checksum += received.payload().size();
+    }
+    double cpuSeconds = cpuTime() - cpuStart;
+    printf("%-8s framing, %d bytes payload: %.0f ns CPU per call  %" PRId64 "\n",
+           inPlace ? "in-place" : "copy", payloadBytes, cpuSeconds * 1e9 / kRounds, checksum);
+  }
+}
+
 int main(int argc, char* argv[])
 {
   LOG_INFO << "pid = " << getpid();
-  if (argc > 1)
+  if (argc > 1 && strcmp(argv[1], "framing") == 0)
+  {
+    benchFraming(argc > 2 ? atoi(argv[2]) : 6);
+  }
+  else if (argc > 1)
   {
     int nClients = 1;
 
@@ -109,9 +184,22 @@ int main(int argc, char* argv[])
       nThreads = atoi(argv[3]);
     }
 
+    if (argc > 4)
+    {
+      g_payload.assign(atoi(argv[4]), 'x');
+    }
+
+    // "copy": serialize payload into RpcMessage first, as before
+    g_inPlaceFraming = !(argc > 5 && strcmp(argv[5], "copy") == 0);
+
     CountDownLatch allConnected(nClients);
     CountDownLatch allFinished(nClients);
 
+    // latency of calls so far at http://localhost:8889/rpc/latency
+    EventLoopThread inspectThread;
+    Inspector inspector(inspectThread.startLoop(), InetAddress(8889), "rpcbench-client");
+    RpcStats::registerCommands(&inspector);
+
     EventLoop loop;
     EventLoopThreadPool pool(&loop, "rpcbench-client");
     pool.setThreadNum(nThreads);
@@ -126,6 +214,7 @@ int main(int argc, char* argv[])
     }
     allConnected.wait();
     Timestamp start(Timestamp::now());
+    double cpuStart = cpuTime();
     LOG_INFO << "all connected";
     for (int i = 0; i < nClients; ++i)
     {
@@ -133,16 +222,22 @@ int main(int argc, char* argv[])
     }
     allFinished.wait();
     Timestamp end(Timestamp::now());
+    double cpuSeconds = cpuTime() - cpuStart;
     LOG_INFO << "all finished";
     double seconds = timeDifference(end, start);
+    printf("%s framing, %zd bytes payload\n",
+           g_inPlaceFraming ? "in-place" : "copy", g_payload.size());
     printf("%f seconds\n", seconds);
     printf("%.1f calls per second\n", nClients * kRequests / seconds);
+    printf("%.2f us CPU per call\n", cpuSeconds * 1e6 / (nClients * kRequests));
+    printf("%s", RpcStats::report().c_str());
 
     exit(0);
   }
   else
   {
-    printf("Usage: %s host_ip numClients [numThreads]\n", argv[0]);
+    printf("Usage: %s host_ip numClients [numThreads] [payloadBytes] [copy]\n", argv[0]);
+    printf("       %s framing [payloadBytes]\n", argv[0]);
   }
 }
 
@@ -1,9 +1,12 @@
 #include "examples/protobuf/rpcbench/echo.pb.h"
 
+#include "muduo/base/Atomic.h"
 #include "muduo/base/Logging.h"
 #include "muduo/net/EventLoop.h"
 #include "muduo/net/protorpc/RpcServer.h"
 
+#include <string.h>
+#include <sys/resource.h>
 #include <unistd.h>
 
 using namespace muduo;
@@ -23,11 +26,41 @@ class EchoServiceImpl : public EchoService
     //LOG_INFO << "EchoServiceImpl::Solve";
     response->set_payload(request->payload());
     done->Run();
+    calls_.increment();
   }
+
+  int64_t calls() { return calls_.get(); }
+
+ private:
+  muduo::AtomicInt64 calls_;
 };
 
 }  // namespace echo
 
+// user + sys seconds of this process
+double cpuTime()
+{
+  struct rusage usage;
+  ::getrusage(RUSAGE_SELF, &usage);
+  return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec)
+      + static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+// CPU per call of last period
+void report(echo::EchoServiceImpl* impl, double* lastCpu, int64_t* lastCalls)
+{
+  const double cpu = cpuTime();
+  const int64_t calls = impl->calls();
+  if (calls > *lastCalls)
+  {
+    LOG_INFO << calls - *lastCalls << " calls, "
+             << (cpu - *lastCpu) * 1e6 / static_cast<double>(calls - *lastCalls)
+             << " us CPU per call";
+  }
+  *lastCpu = cpu;
+  *lastCalls = calls;
+}
+
 int main(int argc, char* argv[])
 {
   int nThreads =  argc > 1 ? atoi(argv[1]) : 1;
@@ -38,8 +71,13 @@ int main(int argc, char* argv[])
   echo::EchoServiceImpl impl;
   RpcServer server(&loop, listenAddr);
   server.setThreadNum(nThreads);
+  // "copy": serialize payload into RpcMessage first, as before
+  server.setInPlaceFraming(!(argc > 3 && strcmp(argv[3], "copy") == 0));
   server.registerService(&impl);
   server.start();
+  double lastCpu = cpuTime();
+  int64_t lastCalls = 0;
+  loop.runEvery(5.0, std::bind(report, &impl, &lastCpu, &lastCalls));
   loop.loop();
 }
 
@@ -3,12 +3,17 @@
 #include "muduo/net/TcpClient.h"
 #include "muduo/net/TcpServer.h"
 
+#include <algorithm>
+#include <vector>
+
+#include <inttypes.h>
 #include <stdio.h>
 
 using namespace muduo;
 using namespace muduo::net;
 
 const size_t frameLen = 2*sizeof(int64_t);
+int busyPollUs = 0;  // EventLoop::setBusyPoll()
 
 void serverConnectionCallback(const TcpConnectionPtr& conn)
 {
@@ -41,6 +46,7 @@ void serverMessageCallback(const TcpConnectionPtr& conn,
 void runServer(uint16_t port)
 {
   EventLoop loop;
+  loop.setBusyPoll(busyPollUs);
   TcpServer server(&loop, InetAddress(port), "ClockServer");
   server.setConnectionCallback(serverConnectionCallback);
   server.setMessageCallback(serverMessageCallback);
@@ -49,6 +55,14 @@ void runServer(uint16_t port)
 }
 
 TcpConnectionPtr clientConnection;
+// measures tail latency if > 0, instead of logging every round trip
+int samplesWanted = 0;
+// ping-pong, next ping this long after the pong, keep it below busy poll
+// time to see what spinning saves
+int gapUs = 0;
+std::vector<int64_t> samples;
+
+void sendMyTime();
 
 void clientConnectionCallback(const TcpConnectionPtr& conn)
 {
@@ -59,6 +73,10 @@ void clientConnectionCallback(const TcpConnectionPtr& conn)
   {
     clientConnection = conn;
     conn->setTcpNoDelay(true);
+    if (samplesWanted > 0)
+    {
+      sendMyTime();
+    }
   }
   else
   {
@@ -66,7 +84,7 @@ void clientConnectionCallback(const TcpConnectionPtr& conn)
   }
 }
 
-void clientMessageCallback(const TcpConnectionPtr&,
+void clientMessageCallback(const TcpConnectionPtr& conn,
                            Buffer* buffer,
                            muduo::Timestamp receiveTime)
 {
@@ -79,11 +97,41 @@ void clientMessageCallback(const TcpConnectionPtr&,
     int64_t their = message[1];
     int64_t back = receiveTime.microSecondsSinceEpoch();
     int64_t mine = (back+send)/2;
+    if (samplesWanted > 0)
+    {
+      samples.push_back(back - send);
+      if (gapUs > 0)
+      {
+        conn->getLoop()->runAfter(gapUs * 1e-6, sendMyTime);
+      }
+      else
+      {
+        sendMyTime();
+      }
+      continue;
+    }
     LOG_INFO << "round trip " << back - send
              << " clock error " << their - mine;
   }
 }
 
+void printPercentiles(EventLoop* loop)
+{
+  if (samples.size() < static_cast<size_t>(samplesWanted))
+  {
+    return;
+  }
+  std::sort(samples.begin(), samples.end());
+  const size_t n = samples.size();
+  printf("busy poll %d us, gap %d us, %zd round trips in us: min %" PRId64 " p50 %" PRId64
+         " p90 %" PRId64 " p99 %" PRId64 " p99.9 %" PRId64 " max %" PRId64 "\n",
+         busyPollUs, gapUs, n, samples[0], samples[n / 2], samples[n * 9 / 10],
+         samples[n * 99 / 100], samples[n * 999 / 1000], samples[n - 1]);
+  printf("client loop: %" PRId64 " productive polls, %" PRId64 " spin polls\n",
+         loop->productivePolls(), loop->spinPolls());
+  loop->quit();
+}
+
 void sendMyTime()
 {
   if (clientConnection)
@@ -97,12 +145,22 @@ void sendMyTime()
 void runClient(const char* ip, uint16_t port)
 {
   EventLoop loop;
+  loop.setBusyPoll(busyPollUs);
   TcpClient client(&loop, InetAddress(ip, port), "ClockClient");
   client.enableRetry();
   client.setConnectionCallback(clientConnectionCallback);
   client.setMessageCallback(clientMessageCallback);
   client.connect();
-  loop.runEvery(0.2, sendMyTime);
+  if (samplesWanted > 0)
+  {
+    // pings go out from clientMessageCallback
+    samples.reserve(samplesWanted);
+    loop.runEvery(0.1, std::bind(printPercentiles, &loop));
+  }
+  else
+  {
+    loop.runEvery(0.2, sendMyTime);
+  }
   loop.loop();
 }
 
@@ -111,6 +169,9 @@ int main(int argc, char* argv[])
   if (argc > 2)
   {
     uint16_t port = static_cast<uint16_t>(atoi(argv[2]));
+    busyPollUs = argc > 3 ? atoi(argv[3]) : 0;
+    samplesWanted = argc > 4 ? atoi(argv[4]) : 0;
+    gapUs = argc > 5 ? atoi(argv[5]) : 0;
     if (strcmp(argv[1], "-s") == 0)
     {
       runServer(port);
@@ -122,7 +183,8 @@ int main(int argc, char* argv[])
   }
   else
   {
-    printf("Usage:\n%s -s port\n%s ip port\n", argv[0], argv[0]);
+    printf("Usage:\n%s -s port [busy_poll_us]\n%s ip port [busy_poll_us [samples [gap_us]]]\n",
+           argv[0], argv[0]);
   }
 }
 
@@ -37,6 +37,11 @@ class AsyncLogging : noncopyable
 
   void append(const char* logline, int len);
 
+  /// Keeps the backend thread, e.g. off the cores of IO loops.
+  /// Must be called before start().
+  void setAffinity(const ThreadAffinity& affinity)
+  { thread_.setAffinity(affinity); }
+
   void start()
   {
     running_ = true;
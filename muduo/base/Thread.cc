@@ -57,19 +57,27 @@ struct ThreadData
   string name_;
   pid_t* tid_;
   CountDownLatch* latch_;
+  ThreadAffinity affinity_;
 
   ThreadData(ThreadFunc func,   // 线程接受的回调函数类型。
              const string& name,     // 线程的名称。
              pid_t* tid,                    // 线程的真实id。
-             CountDownLatch* latch)
+             CountDownLatch* latch,
+             const ThreadAffinity& affinity)
     : func_(std::move(func)),
       name_(name),
       tid_(tid),
-      latch_(latch)
+      latch_(latch),
+      affinity_(affinity)
   { }
 
   void runInThread()
   {
+    // 先绑核，线程分配的内存才会落在本地节点上。
+    if (!affinity_.empty())
+    {
+      affinity_.apply();
+    }
     *tid_ = muduo::CurrentThread::tid();
     tid_ = NULL;
     latch_->countDown();  // 运行前就对其进行了 -- 操作。
@@ -137,7 +145,8 @@ void CurrentThread::sleepUsec(int64_t usec)
   ts.tv_sec = static_cast<time_t>(usec / Timestamp::kMicroSecondsPerSecond);
   ts.tv_nsec = static_cast<long>(usec % Timestamp::kMicroSecondsPerSecond * 1000);
   // nanosleep() 函数会导致当前的线程将暂停执行, 直到rqtp参数所指定的时间间隔。
-  // 或者在指定时间间隔内有信号传递到当前线程，将引起当前线程调用信号捕获函数或终止该线程。 ::nanosleep(&ts, NULL);
+  // 或者在指定时间间隔内有信号传递到当前线程，将引起当前线程调用信号捕获函数或终止该线程。
+  ::nanosleep(&ts, NULL);
 }
 
 // 静态成员变量，是原子性的。
@@ -182,7 +191,7 @@ void Thread::start()
   started_ = true;
   // FIXME: move(func_)
   // 这里相当于是去获取线程的信息。
-  detail::ThreadData* data = new detail::ThreadData(func_, name_, &tid_, &latch_);
+  detail::ThreadData* data = new detail::ThreadData(func_, name_, &tid_, &latch_, affinity_);
   // 创建线程，data是是关于线程的参数，是一个ThreadData类。
   if (pthread_create(&pthreadId_, NULL, &detail::startThread, data))
   { // 如果启动失败，则需要释放资源等操作。
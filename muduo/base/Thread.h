@@ -13,6 +13,7 @@
 
 #include "muduo/base/Atomic.h"
 #include "muduo/base/CountDownLatch.h"
+#include "muduo/base/ThreadAffinity.h"
 #include "muduo/base/Types.h"
 
 #include <functional>
@@ -32,6 +33,11 @@ class Thread : noncopyable
   // FIXME: make it movable in C++11
   ~Thread();
 
+  /// CPUs and NUMA node, applied in the new thread before ThreadFunc runs.
+  /// Must be called before start().
+  void setAffinity(const ThreadAffinity& affinity) { affinity_ = affinity; }
+  const ThreadAffinity& affinity() const { return affinity_; }
+
   void start();
   int join(); // return pthread_join()
 
@@ -53,6 +59,7 @@ class Thread : noncopyable
   ThreadFunc func_; // 回调函数。
   string     name_; // 线程的名称。
   CountDownLatch latch_; // 这是一个倒计时门闩类。
+  ThreadAffinity affinity_;
   // 这里就是一个int类型的意思。
   static AtomicInt32 numCreated_; // 创建线程的数量。这里都只是声明，静态成员变量。
 };
@@ -0,0 +1,211 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/base/ThreadAffinity.h"
+
+#include "muduo/base/FileUtil.h"
+#include "muduo/base/Logging.h"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+using namespace muduo;
+
+namespace
+{
+
+const int kMpolPreferred = 1;  // <linux/mempolicy.h>, no libnuma
+
+string readSysFile(const char* path)
+{
+  string content;
+  FileUtil::readFile(path, 4096, &content);
+  return content;
+}
+
+}  // namespace
+
+ThreadAffinity ThreadAffinity::onCpus(const std::vector<int>& cpus)
+{
+  ThreadAffinity affinity;
+  affinity.cpus_ = cpus;
+  std::sort(affinity.cpus_.begin(), affinity.cpus_.end());
+  affinity.cpus_.erase(std::unique(affinity.cpus_.begin(), affinity.cpus_.end()),
+                       affinity.cpus_.end());
+  for (size_t i = 0; i < affinity.cpus_.size(); ++i)
+  {
+    int node = nodeOfCpu(affinity.cpus_[i]);
+    if (i > 0 && node != affinity.node_)
+    {
+      // spans nodes, leave memory alone
+      affinity.node_ = -1;
+      break;
+    }
+    affinity.node_ = node;
+  }
+  return affinity;
+}
+
+ThreadAffinity ThreadAffinity::onNode(int node)
+{
+  ThreadAffinity affinity;
+  affinity.cpus_ = cpusOfNode(node);
+  affinity.node_ = node;
+  return affinity;
+}
+
+std::vector<ThreadAffinity> ThreadAffinity::perCpu(const std::vector<int>& cpus)
+{
+  std::vector<ThreadAffinity> result;
+  for (int cpu : cpus)
+  {
+    result.push_back(onCpus(std::vector<int>(1, cpu)));
+  }
+  return result;
+}
+
+std::vector<ThreadAffinity> ThreadAffinity::perNode()
+{
+  std::vector<ThreadAffinity> result;
+  const int nodes = numNodes();
+  for (int node = 0; node < nodes; ++node)
+  {
+    ThreadAffinity affinity = onNode(node);
+    if (!affinity.cpus_.empty())
+    {
+      result.push_back(affinity);
+    }
+  }
+  return result;
+}
+
+string ThreadAffinity::toString() const
+{
+  string result("cpus ");
+  for (size_t i = 0; i < cpus_.size(); ++i)
+  {
+    char buf[32];
+    snprintf(buf, sizeof buf, i == 0 ? "%d" : ",%d", cpus_[i]);
+    result += buf;
+  }
+  char buf[32];
+  snprintf(buf, sizeof buf, " node %d", node_);
+  result += buf;
+  return result;
+}
+
+bool ThreadAffinity::apply() const
+{
+  bool ok = true;
+  if (!cpus_.empty())
+  {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus_)
+    {
+      if (0 <= cpu && cpu < CPU_SETSIZE)
+      {
+        CPU_SET(cpu, &set);
+      }
+    }
+    if (::sched_setaffinity(0, sizeof set, &set) < 0)
+    {
+      LOG_SYSERR << "ThreadAffinity::apply sched_setaffinity " << toString();
+      ok = false;
+    }
+  }
+  if (node_ >= 0 && numNodes() > 1)
+  {
+    const int kBitsPerLong = static_cast<int>(8 * sizeof(unsigned long));
+    unsigned long mask[4] = { 0, 0, 0, 0 };
+    if (node_ < 4 * kBitsPerLong)
+    {
+      mask[node_ / kBitsPerLong] = 1UL << (node_ % kBitsPerLong);
+      if (::syscall(SYS_set_mempolicy, kMpolPreferred, mask, 4 * kBitsPerLong + 1) < 0)
+      {
+        LOG_SYSERR << "ThreadAffinity::apply set_mempolicy " << toString();
+        ok = false;
+      }
+    }
+  }
+  return ok;
+}
+
+std::vector<int> ThreadAffinity::parseCpuList(const StringPiece& list)
+{
+  std::vector<int> cpus;
+  string str(list.data(), list.size());
+  const char* p = str.c_str();
+  while (*p != '\0' && *p != '\n')
+  {
+    char* end = NULL;
+    long first = ::strtol(p, &end, 10);
+    if (end == p || first < 0)
+    {
+      return std::vector<int>();
+    }
+    long last = first;
+    p = end;
+    if (*p == '-')
+    {
+      ++p;
+      last = ::strtol(p, &end, 10);
+      if (end == p || last < first)
+      {
+        return std::vector<int>();
+      }
+      p = end;
+    }
+    for (long cpu = first; cpu <= last; ++cpu)
+    {
+      cpus.push_back(static_cast<int>(cpu));
+    }
+    if (*p == ',')
+    {
+      ++p;
+    }
+    else if (*p != '\0' && *p != '\n')
+    {
+      return std::vector<int>();
+    }
+  }
+  return cpus;
+}
+
+int ThreadAffinity::numNodes()
+{
+  std::vector<int> nodes = parseCpuList(readSysFile("/sys/devices/system/node/online"));
+  return nodes.empty() ? 1 : nodes.back() + 1;
+}
+
+std::vector<int> ThreadAffinity::cpusOfNode(int node)
+{
+  char path[64];
+  snprintf(path, sizeof path, "/sys/devices/system/node/node%d/cpulist", node);
+  return parseCpuList(readSysFile(path));
+}
+
+int ThreadAffinity::nodeOfCpu(int cpu)
+{
+  const int nodes = numNodes();
+  for (int node = 0; node < nodes; ++node)
+  {
+    std::vector<int> cpus = cpusOfNode(node);
+    if (std::binary_search(cpus.begin(), cpus.end(), cpu))
+    {
+      return node;
+    }
+  }
+  return -1;
+}
@@ -0,0 +1,67 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+//
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_BASE_THREADAFFINITY_H
+#define MUDUO_BASE_THREADAFFINITY_H
+
+#include "muduo/base/copyable.h"
+#include "muduo/base/StringPiece.h"
+
+#include <vector>
+
+namespace muduo
+{
+
+///
+/// Where a thread runs: a set of CPUs, and the NUMA node its memory
+/// comes from. Default constructed one leaves the thread alone.
+///
+/// Memory is bound with set_mempolicy(MPOL_PREFERRED), so everything the
+/// thread allocates and touches first, e.g. Buffer of its EventLoop,
+/// lands on that node. No libnuma needed, topology is read from sysfs.
+class ThreadAffinity : public muduo::copyable
+{
+ public:
+  ThreadAffinity()
+    : node_(-1)
+  { }
+
+  /// On these CPUs, memory from their node if they share one.
+  static ThreadAffinity onCpus(const std::vector<int>& cpus);
+  /// On all CPUs of the node, memory from the node.
+  static ThreadAffinity onNode(int node);
+
+  /// One per CPU, for a pool with a thread per core, e.g. "0-7,16-23".
+  static std::vector<ThreadAffinity> perCpu(const std::vector<int>& cpus);
+  /// One per NUMA node, threads of a pool spread across nodes.
+  static std::vector<ThreadAffinity> perNode();
+
+  bool empty() const { return cpus_.empty() && node_ < 0; }
+  const std::vector<int>& cpus() const { return cpus_; }
+  int node() const { return node_; }
+  string toString() const;
+
+  /// Places the calling thread, returns false if the kernel refused.
+  bool apply() const;
+
+  /// "0-3,8,10-11" as in /sys and taskset(1), empty if malformed.
+  static std::vector<int> parseCpuList(const StringPiece& list);
+  static int numNodes();  // 1 if the kernel has no NUMA
+  static std::vector<int> cpusOfNode(int node);
+  static int nodeOfCpu(int cpu);  // -1 if unknown
+
+ private:
+  std::vector<int> cpus_;
+  int node_;
+};
+
+}  // namespace muduo
+
+#endif  // MUDUO_BASE_THREADAFFINITY_H
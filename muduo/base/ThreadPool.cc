@@ -43,6 +43,10 @@ void ThreadPool::start(int numThreads)
     // 创建指定数量的线程。
     threads_.emplace_back(new muduo::Thread(
           std::bind(&ThreadPool::runInThread, this), name_+id));
+    if (!affinities_.empty())
+    {
+      threads_[i]->setAffinity(affinities_[i % affinities_.size()]);
+    }
     threads_[i]->start();
   }
   // 如果没有线程、但是有任务，这个时候就可以让主线程去执行程序。
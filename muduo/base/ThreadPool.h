@@ -29,6 +29,9 @@ class ThreadPool : noncopyable
   void setMaxQueueSize(int maxSize) { maxQueueSize_ = maxSize; }
   void setThreadInitCallback(const Task& cb)
   { threadInitCallback_ = cb; }   // 设置初始任务。
+  // Thread i is placed on affinities[i % size], see ThreadAffinity::perCpu().
+  void setThreadAffinity(const std::vector<ThreadAffinity>& affinities)
+  { affinities_ = affinities; }
 
   void start(int numThreads);
   void stop();
@@ -56,6 +59,7 @@ class ThreadPool : noncopyable
   Condition notFull_ GUARDED_BY(mutex_);
   string name_;
   Task threadInitCallback_; // 这里是任务。
+  std::vector<ThreadAffinity> affinities_;
   // 一个线程向量。
   std::vector<std::unique_ptr<muduo::Thread>> threads_;
   // 任务队列。
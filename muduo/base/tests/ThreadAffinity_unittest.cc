@@ -0,0 +1,93 @@
+#include "muduo/base/ThreadAffinity.h"
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/Thread.h"
+#include "muduo/base/ThreadPool.h"
+
+//#define BOOST_TEST_MODULE ThreadAffinityTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sched.h>
+
+using muduo::ThreadAffinity;
+
+namespace
+{
+
+std::vector<int> allowedCpus()
+{
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  ::sched_getaffinity(0, sizeof set, &set);
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+  {
+    if (CPU_ISSET(cpu, &set))
+    {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+void recordCpus(std::vector<int>* cpus, muduo::CountDownLatch* latch)
+{
+  *cpus = allowedCpus();
+  latch->countDown();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(testParseCpuList)
+{
+  std::vector<int> cpus = ThreadAffinity::parseCpuList("0-3,8,10-11\n");
+  const int expected[] = { 0, 1, 2, 3, 8, 10, 11 };
+  BOOST_CHECK_EQUAL_COLLECTIONS(cpus.begin(), cpus.end(),
+                                expected, expected + sizeof expected / sizeof expected[0]);
+  BOOST_CHECK_EQUAL(ThreadAffinity::parseCpuList("5").size(), 1u);
+  BOOST_CHECK(ThreadAffinity::parseCpuList("").empty());
+  BOOST_CHECK(ThreadAffinity::parseCpuList("3-1").empty());
+  BOOST_CHECK(ThreadAffinity::parseCpuList("1,x").empty());
+}
+
+BOOST_AUTO_TEST_CASE(testTopology)
+{
+  BOOST_CHECK_GE(ThreadAffinity::numNodes(), 1);
+  BOOST_CHECK(ThreadAffinity().empty());
+  std::vector<ThreadAffinity> nodes = ThreadAffinity::perNode();
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    BOOST_CHECK(!nodes[i].cpus().empty());
+    BOOST_CHECK_EQUAL(ThreadAffinity::nodeOfCpu(nodes[i].cpus().front()), nodes[i].node());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testThreadIsPlaced)
+{
+  const int cpu = allowedCpus().back();
+  std::vector<int> cpus;
+  muduo::CountDownLatch latch(1);
+  muduo::Thread thread(std::bind(recordCpus, &cpus, &latch), "placed");
+  thread.setAffinity(ThreadAffinity::onCpus(std::vector<int>(1, cpu)));
+  thread.start();
+  thread.join();
+  BOOST_REQUIRE_EQUAL(cpus.size(), 1u);
+  BOOST_CHECK_EQUAL(cpus[0], cpu);
+  BOOST_CHECK_EQUAL(thread.affinity().node(), ThreadAffinity::nodeOfCpu(cpu));
+}
+
+BOOST_AUTO_TEST_CASE(testThreadPoolIsPlaced)
+{
+  const int cpu = allowedCpus().front();
+  std::vector<int> cpus;
+  muduo::ThreadPool pool("placed");
+  pool.setThreadAffinity(ThreadAffinity::perCpu(std::vector<int>(1, cpu)));
+  pool.start(1);
+  muduo::CountDownLatch latch(1);
+  pool.run(std::bind(recordCpus, &cpus, &latch));
+  latch.wait();
+  pool.stop();
+  BOOST_REQUIRE_EQUAL(cpus.size(), 1u);
+  BOOST_CHECK_EQUAL(cpus[0], cpu);
+}
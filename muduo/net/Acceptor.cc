@@ -22,12 +22,15 @@
 using namespace muduo;
 using namespace muduo::net;
 
+const int Acceptor::kDefaultMaxAcceptsPerRead;
+
 Acceptor::Acceptor(EventLoop* loop, const InetAddress& listenAddr, bool reuseport)
   : loop_(loop),
     acceptSocket_(sockets::createNonblockingOrDie(listenAddr.family())), // 创建一个套接字，并没有传入地址等。
     acceptChannel_(loop, acceptSocket_.fd()), // 关注这个套接字。
     listening_(false),
-    idleFd_(::open("/dev/null", O_RDONLY | O_CLOEXEC))
+    idleFd_(::open("/dev/null", O_RDONLY | O_CLOEXEC)),
+    maxAcceptsPerRead_(kDefaultMaxAcceptsPerRead)
 {
   assert(idleFd_ >= 0);
   acceptSocket_.setReuseAddr(true);
@@ -55,11 +58,20 @@ void Acceptor::listen()
 void Acceptor::handleRead()
 {
   loop_->assertInLoopThread();
-  InetAddress peerAddr;
-  //FIXME loop until no more
-  // 此处的连接也就是打开的文件描述符。
-  int connfd = acceptSocket_.accept(&peerAddr); // 获取一个连接的事件。
-  if (connfd >= 0){
+  // drain the backlog, bounded so that other channels of this loop are not starved
+  for (int i = 0; i < maxAcceptsPerRead_; ++i)
+  {
+    InetAddress peerAddr;
+    // 此处的连接也就是打开的文件描述符。
+    int connfd = acceptSocket_.accept(&peerAddr); // 获取一个连接的事件。
+    if (connfd < 0)
+    {
+      if (errno != EAGAIN)
+      {
+        handleAcceptError();
+      }
+      break;
+    }
     // string hostport = peerAddr.toIpPort();
     // LOG_TRACE << "Accepts of " << hostport;
     if (newConnectionCallback_){
@@ -68,17 +80,20 @@ void Acceptor::handleRead()
     else{
       sockets::close(connfd);
     }
-  }else{
-    LOG_SYSERR << "in Acceptor::handleRead";
-    // Read the section named "The special problem of
-    // accept()ing when you can't" in libev's doc.
-    // By Marc Lehmann, author of libev.
-    if (errno == EMFILE){ // 文件描述符打开太多的处理方式。
-      ::close(idleFd_);
-      idleFd_ = ::accept(acceptSocket_.fd(), NULL, NULL);
-      ::close(idleFd_);
-      idleFd_ = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
-    }
+  }
+}
+
+void Acceptor::handleAcceptError()
+{
+  LOG_SYSERR << "in Acceptor::handleRead";
+  // Read the section named "The special problem of
+  // accept()ing when you can't" in libev's doc.
+  // By Marc Lehmann, author of libev.
+  if (errno == EMFILE){ // 文件描述符打开太多的处理方式。
+    ::close(idleFd_);
+    idleFd_ = ::accept(acceptSocket_.fd(), NULL, NULL);
+    ::close(idleFd_);
+    idleFd_ = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
   }
 }
 
@@ -31,6 +31,7 @@ class Acceptor : noncopyable
 {
  public:
   typedef std::function<void (int sockfd, const InetAddress&)> NewConnectionCallback;
+  static const int kDefaultMaxAcceptsPerRead = 64;
 
   Acceptor(EventLoop* loop, const InetAddress& listenAddr, bool reuseport);
   ~Acceptor();
@@ -40,6 +41,10 @@ class Acceptor : noncopyable
 
   void listen();
 
+  /// Accepts up to @c n connections per readable event, stops earlier on EAGAIN.
+  void setMaxAcceptsPerRead(int n)
+  { maxAcceptsPerRead_ = n; }
+
   bool listening() const { return listening_; }
 
   // Deprecated, use the correct spelling one above.
@@ -48,6 +53,7 @@ class Acceptor : noncopyable
 
  private:
   void handleRead();
+  void handleAcceptError();
 
   EventLoop* loop_;           // 所属的EventLoop对象。
   Socket acceptSocket_;     // 监听套接字。
@@ -55,6 +61,7 @@ class Acceptor : noncopyable
   NewConnectionCallback newConnectionCallback_;   // 连接的回调函数，比如告诉谁连接了。
   bool listening_;                // 是否处于监听的状态。
   int idleFd_;                      // 方式文件描述符的溢出。
+  int maxAcceptsPerRead_;
 };
 
 }  // namespace net
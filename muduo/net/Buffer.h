@@ -16,6 +16,7 @@
 #include "muduo/base/Types.h"
 
 #include "muduo/net/Endian.h"
+#include "muduo/net/StringSearch.h"
 
 #include <algorithm>
 #include <vector>
@@ -79,18 +80,27 @@ class Buffer : public muduo::copyable
 
   const char* findCRLF() const
   {
-    // FIXME: replace with memmem()?
-    const char* crlf = std::search(peek(), beginWrite(), kCRLF, kCRLF+2);
-    return crlf == beginWrite() ? NULL : crlf;
+    return search::find(peek(), beginWrite(), kCRLF, 2);
   }
   // 查找/r/n
   const char* findCRLF(const char* start) const
   {
     assert(peek() <= start);
     assert(start <= beginWrite());
-    // FIXME: replace with memmem()?
-    const char* crlf = std::search(start, beginWrite(), kCRLF, kCRLF+2);
-    return crlf == beginWrite() ? NULL : crlf;
+    return search::find(start, beginWrite(), kCRLF, 2);
+  }
+
+  /// Finds a multi-byte delimiter, e.g. "\r\n\r\n", NULL if not found.
+  const char* findDelimiter(const StringPiece& delim) const
+  {
+    return search::find(peek(), beginWrite(), delim.data(), delim.size());
+  }
+
+  const char* findDelimiter(const char* start, const StringPiece& delim) const
+  {
+    assert(peek() <= start);
+    assert(start <= beginWrite());
+    return search::find(start, beginWrite(), delim.data(), delim.size());
   }
 
   const char* findEOL() const
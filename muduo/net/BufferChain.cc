@@ -0,0 +1,387 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+
+#include "muduo/net/BufferChain.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/BufferPool.h"
+#include "muduo/net/SocketsOps.h"
+
+#include <errno.h>
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const size_t BufferChain::kMaxChunkSize;
+const int BufferChain::kMaxIovecs;
+
+FileRegion::FileRegion(int fd, int64_t offset, size_t length)
+  : fd_(::dup(fd)),
+    offset_(offset),
+    length_(length)
+{
+  if (fd_ < 0)
+  {
+    LOG_SYSERR << "FileRegion::FileRegion dup " << fd;
+    length_ = 0;
+  }
+}
+
+FileRegion::~FileRegion()
+{
+  if (fd_ >= 0)
+  {
+    ::close(fd_);
+  }
+}
+
+size_t BufferChain::internalCapacity() const
+{
+  size_t capacity = 0;
+  for (const Chunk& chunk : chunks_)
+  {
+    if (chunk.buffer)
+    {
+      capacity += chunk.buffer->internalCapacity();
+    }
+  }
+  return capacity;
+}
+
+// chunks grow geometrically up to kMaxChunkSize, a larger payload gets
+// a chunk of its own size, so it is copied exactly once.
+size_t BufferChain::nextChunkSize(size_t len) const
+{
+  size_t size = Buffer::kInitialSize;
+  if (!chunks_.empty() && chunks_.back().buffer)
+  {
+    size = std::min(2 * chunks_.back().buffer->internalCapacity(), kMaxChunkSize);
+  }
+  return std::max(size, len);
+}
+
+void BufferChain::append(const char* /*restrict*/ data, size_t len)
+{
+  if (len == 0)
+  {
+    return;
+  }
+  size_t written = 0;
+  if (tailAppendable_)
+  {
+    // fill up the tail chunk, but never let it grow (that would move data)
+    Buffer* tail = chunks_.back().buffer.get();
+    written = std::min(tail->writableBytes(), len);
+    tail->append(data, written);
+  }
+  if (written < len)
+  {
+    const size_t remaining = len - written;
+    const size_t chunkSize = nextChunkSize(remaining);
+    Chunk chunk;
+    if (pool_ && chunkSize <= BufferPool::kMaxSize)
+    {
+      chunk.buffer = pool_->get(chunkSize);
+      chunk.pooled = true;
+    }
+    else
+    {
+      chunk.buffer.reset(new Buffer(chunkSize));
+    }
+    chunk.buffer->append(data + written, remaining);
+    chunks_.push_back(std::move(chunk));
+    tailAppendable_ = true;
+  }
+  readableBytes_ += len;
+}
+
+void BufferChain::append(BufferPtr buffer)
+{
+  const size_t len = buffer->readableBytes();
+  if (len > 0)
+  {
+    Chunk chunk;
+    chunk.buffer = std::move(buffer);
+    chunks_.push_back(std::move(chunk));
+    tailAppendable_ = false;
+    readableBytes_ += len;
+  }
+}
+
+void BufferChain::append(FileRegionPtr file)
+{
+  const size_t len = file->length();
+  if (len > 0)
+  {
+    Chunk chunk;
+    chunk.file = std::move(file);
+    chunks_.push_back(std::move(chunk));
+    tailAppendable_ = false;
+    readableBytes_ += len;
+  }
+}
+
+void BufferChain::retrieve(size_t len)
+{
+  assert(len <= readableBytes_);
+  readableBytes_ -= len;
+  while (len > 0)
+  {
+    assert(!chunks_.empty());
+    Chunk& head = chunks_.front();
+    const size_t readable = head.readableBytes();
+    if (len < readable)
+    {
+      if (head.file)
+      {
+        head.file->retrieve(len);
+      }
+      else
+      {
+        head.buffer->retrieve(len);
+      }
+      len = 0;
+    }
+    else
+    {
+      len -= readable;
+      recycle(&head);
+      chunks_.pop_front();
+    }
+  }
+  if (chunks_.empty())
+  {
+    tailAppendable_ = false;
+  }
+}
+
+void BufferChain::recycle(Chunk* chunk)
+{
+  if (chunk->pooled && pool_)
+  {
+    pool_->put(std::move(chunk->buffer));
+  }
+}
+
+void BufferChain::retrieveAll()
+{
+  for (Chunk& chunk : chunks_)
+  {
+    recycle(&chunk);
+  }
+  chunks_.clear();
+  readableBytes_ = 0;
+  tailAppendable_ = false;
+}
+
+string BufferChain::retrieveAllAsString()
+{
+  string result;
+  result.reserve(readableBytes_);
+  for (const Chunk& chunk : chunks_)
+  {
+    if (chunk.file)
+    {
+      char buf[64*1024];
+      int64_t offset = chunk.file->offset();
+      size_t remaining = chunk.file->length();
+      while (remaining > 0)
+      {
+        ssize_t n = ::pread(chunk.file->fd(), buf, std::min(remaining, sizeof buf), offset);
+        if (n <= 0)
+        {
+          break;
+        }
+        result.append(buf, n);
+        offset += n;
+        remaining -= n;
+      }
+    }
+    else
+    {
+      result.append(chunk.buffer->peek(), chunk.buffer->readableBytes());
+    }
+  }
+  retrieveAll();
+  return result;
+}
+
+int BufferChain::peekIovec(struct iovec* vec, int maxvec) const
+{
+  int iovcnt = 0;
+  for (std::deque<Chunk>::const_iterator it = chunks_.begin();
+       it != chunks_.end() && !it->file && iovcnt < maxvec;
+       ++it)
+  {
+    vec[iovcnt].iov_base = const_cast<char*>(it->buffer->peek());
+    vec[iovcnt].iov_len = it->buffer->readableBytes();
+    ++iovcnt;
+  }
+  return iovcnt;
+}
+
+size_t BufferChain::copyOut(char* buf, size_t len) const
+{
+  size_t copied = 0;
+  for (std::deque<Chunk>::const_iterator it = chunks_.begin();
+       it != chunks_.end() && !it->file && copied < len;
+       ++it)
+  {
+    const size_t n = std::min(len - copied, it->buffer->readableBytes());
+    memcpy(buf + copied, it->buffer->peek(), n);
+    copied += n;
+  }
+  return copied;
+}
+
+ssize_t BufferChain::writeFd(int fd, int* savedErrno)
+{
+  if (!chunks_.empty() && chunks_.front().file)
+  {
+    return sendFile(fd, savedErrno);
+  }
+  if (zeroCopyHead())
+  {
+    ssize_t n = sendZeroCopy(fd, savedErrno);
+    // ENOBUFS: over optmem limit of pinned pages, copy this time
+    if (n >= 0 || *savedErrno != ENOBUFS)
+    {
+      return n;
+    }
+  }
+  struct iovec vec[kMaxIovecs];
+  const int iovcnt = peekIovec(vec, kMaxIovecs);
+  const ssize_t n = sockets::writev(fd, vec, iovcnt);
+  if (n < 0)
+  {
+    *savedErrno = errno;
+  }
+  else
+  {
+    retrieve(n);
+  }
+  return n;
+}
+
+ssize_t BufferChain::sendFile(int fd, int* savedErrno)
+{
+  const FileRegionPtr& file = chunks_.front().file;
+  off_t offset = file->offset();
+  const ssize_t n = sockets::sendfile(fd, file->fd(), &offset, file->length());
+  if (n < 0)
+  {
+    *savedErrno = errno;
+  }
+  else if (n == 0)
+  {
+    // the file was truncated after queuing, give up the rest of region.
+    LOG_ERROR << "BufferChain::sendFile - unexpected EOF of fd " << file->fd()
+              << ", " << file->length() << " bytes dropped";
+    retrieve(file->length());
+    *savedErrno = ENODATA;
+    return -1;
+  }
+  else
+  {
+    retrieve(n);
+  }
+  return n;
+}
+
+bool BufferChain::zeroCopyHead() const
+{
+  // pooled chunks would be reused while kernel still reads them
+  return zeroCopyThreshold_ > 0
+      && !chunks_.empty()
+      && !chunks_.front().file
+      && !chunks_.front().pooled
+      && chunks_.front().buffer->readableBytes() >= zeroCopyThreshold_;
+}
+
+ssize_t BufferChain::sendZeroCopy(int fd, int* savedErrno)
+{
+#ifdef MSG_ZEROCOPY
+  const BufferPtr& buffer = chunks_.front().buffer;
+  struct iovec vec;
+  vec.iov_base = const_cast<char*>(buffer->peek());
+  vec.iov_len = buffer->readableBytes();
+  struct msghdr msg;
+  memZero(&msg, sizeof msg);
+  msg.msg_iov = &vec;
+  msg.msg_iovlen = 1;
+  const ssize_t n = ::sendmsg(fd, &msg, MSG_ZEROCOPY);
+  if (n < 0)
+  {
+    *savedErrno = errno;
+  }
+  else
+  {
+    // only written bytes are pinned, but the whole chunk is kept
+    zeroCopyInflight_.push_back(std::make_pair(zeroCopySequence_++, buffer));
+    retrieve(n);
+  }
+  return n;
+#else
+  *savedErrno = ENOBUFS;
+  return -1;
+#endif
+}
+
+int BufferChain::releaseZeroCopied(int fd)
+{
+  int notifications = 0;
+  char control[128];
+  while (!zeroCopyInflight_.empty())
+  {
+    struct msghdr msg;
+    memZero(&msg, sizeof msg);
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof control;
+    if (::recvmsg(fd, &msg, MSG_ERRQUEUE) < 0)
+    {
+      if (errno != EAGAIN)
+      {
+        LOG_SYSERR << "BufferChain::releaseZeroCopied";
+      }
+      break;
+    }
+    for (struct cmsghdr* cm = CMSG_FIRSTHDR(&msg); cm != NULL; cm = CMSG_NXTHDR(&msg, cm))
+    {
+      if (!((cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR)
+            || (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR)))
+      {
+        continue;
+      }
+      const struct sock_extended_err* err =
+          reinterpret_cast<const struct sock_extended_err*>(CMSG_DATA(cm));
+      if (err->ee_errno != 0 || err->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+      {
+        continue;
+      }
+      ++notifications;
+      // sends ee_info to ee_data are done, notifications may be merged
+      const uint32_t hi = err->ee_data;
+      while (!zeroCopyInflight_.empty()
+             && static_cast<int32_t>(zeroCopyInflight_.front().first - hi) <= 0)
+      {
+        zeroCopyInflight_.pop_front();
+      }
+      if (err->ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+      {
+        LOG_TRACE << "fd " << fd << " MSG_ZEROCOPY fell back to copy, up to " << hi;
+      }
+    }
+  }
+  return notifications;
+}
@@ -0,0 +1,195 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_BUFFERCHAIN_H
+#define MUDUO_NET_BUFFERCHAIN_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/StringPiece.h"
+#include "muduo/base/Types.h"
+#include "muduo/net/Buffer.h"
+
+#include <deque>
+#include <memory>
+
+struct iovec;
+
+namespace muduo
+{
+namespace net
+{
+
+class BufferPool;
+
+typedef std::shared_ptr<Buffer> BufferPtr;
+
+///
+/// A region of a file, to be sent with sendfile(2).
+///
+/// It owns a dup(2) of the file descriptor, closed when destructs,
+/// so the caller may close its own fd right after queuing the region.
+class FileRegion : noncopyable
+{
+ public:
+  FileRegion(int fd, int64_t offset, size_t length);
+  ~FileRegion();
+
+  int fd() const { return fd_; }
+  int64_t offset() const { return offset_; }
+  size_t length() const { return length_; }
+
+  void retrieve(size_t len)
+  {
+    assert(len <= length_);
+    offset_ += len;
+    length_ -= len;
+  }
+
+ private:
+  const int fd_;
+  int64_t offset_;
+  size_t length_;
+};
+
+typedef std::shared_ptr<FileRegion> FileRegionPtr;
+
+/// A queue of refcounted Buffer chunks, used as output buffer of TcpConnection.
+///
+/// Unlike a single Buffer, appending never reallocates or moves bytes
+/// already queued: when the tail chunk is full, a new chunk is linked in.
+/// Buffered chunks are drained with one writev(2), file regions are
+/// interleaved in order and drained with sendfile(2).
+///
+/// @code
+/// +---------+    +-------------------+    +-----------+
+/// | chunk 0 | -> |      chunk 1      | -> |  chunk 2  | -> ...
+/// +---------+    +-------------------+    +-----------+
+/// ^ peek                                        append ^
+/// @endcode
+class BufferChain : noncopyable
+{
+ public:
+  static const size_t kMaxChunkSize = 64*1024;
+  static const int kMaxIovecs = 64;
+
+  BufferChain()
+    : pool_(NULL),
+      readableBytes_(0),
+      tailAppendable_(false),
+      zeroCopyThreshold_(0),
+      zeroCopySequence_(0)
+  { }
+
+  /// Takes chunks from @c pool and gives them back when drained.
+  /// The chain must then be used in the loop thread of @c pool only.
+  void setBufferPool(BufferPool* pool)
+  { pool_ = pool; }
+
+  size_t readableBytes() const
+  { return readableBytes_; }
+
+  bool empty() const
+  { return readableBytes_ == 0; }
+
+  size_t numChunks() const
+  { return chunks_.size(); }
+
+  /// Sum of capacity of all chunks, for diagnostic.
+  size_t internalCapacity() const;
+
+  /// Sends a head chunk of at least @c threshold bytes with MSG_ZEROCOPY,
+  /// 0 to disable (default). The socket must have SO_ZEROCOPY set.
+  /// Only chunks not taken from BufferPool qualify, e.g. those linked by
+  /// append(BufferPtr), and they are kept alive until the kernel reports
+  /// completion, see releaseZeroCopied().
+  void setZeroCopyThreshold(size_t threshold)
+  { zeroCopyThreshold_ = threshold; }
+
+  size_t zeroCopyThreshold() const
+  { return zeroCopyThreshold_; }
+
+  /// Number of MSG_ZEROCOPY sends not yet completed.
+  size_t zeroCopyInflight() const
+  { return zeroCopyInflight_.size(); }
+
+  /// Reads completion notifications from the error queue of @c fd,
+  /// releases chunks of completed sends.
+  /// @return number of notifications read
+  int releaseZeroCopied(int fd);
+
+  void append(const StringPiece& str)
+  { append(str.data(), str.size()); }
+
+  void append(const void* /*restrict*/ data, size_t len)
+  { append(static_cast<const char*>(data), len); }
+
+  /// Copies data into the tail chunk, or into a new chunk if the tail is full.
+  void append(const char* /*restrict*/ data, size_t len);
+
+  /// Links a chunk at the tail, without copying its content.
+  void append(BufferPtr chunk);
+
+  /// Links a file region at the tail.
+  void append(FileRegionPtr file);
+
+  void retrieve(size_t len);
+  void retrieveAll();
+  string retrieveAllAsString();
+
+  /// Fills at most @c maxvec iovecs from the head of the queue,
+  /// stops at the first file region.
+  /// @return number of iovecs filled
+  int peekIovec(struct iovec* vec, int maxvec) const;
+
+  /// Copies at most @c len bytes from the head of the queue,
+  /// stops at the first file region. Nothing is retrieved.
+  size_t copyOut(char* buf, size_t len) const;
+
+  /// Writes queued data with writev(2), or sendfile(2) if a file region
+  /// is at the head, or sendmsg(2) with MSG_ZEROCOPY if the head chunk
+  /// qualifies, and retrieves what was written.
+  ///
+  /// @return result of the syscall, @c errno is saved
+  ssize_t writeFd(int fd, int* savedErrno);
+
+ private:
+  struct Chunk
+  {
+    Chunk() : pooled(false) { }
+
+    BufferPtr buffer;
+    FileRegionPtr file;  // set if this is a file region
+    bool pooled;         // buffer was taken from BufferPool
+
+    size_t readableBytes() const
+    { return file ? file->length() : buffer->readableBytes(); }
+  };
+
+  size_t nextChunkSize(size_t len) const;
+  void recycle(Chunk* chunk);
+  ssize_t sendFile(int fd, int* savedErrno);
+  bool zeroCopyHead() const;
+  ssize_t sendZeroCopy(int fd, int* savedErrno);
+
+  BufferPool* pool_;
+  std::deque<Chunk> chunks_;
+  size_t readableBytes_;
+  bool tailAppendable_;  // false if the tail chunk was linked in by user
+  size_t zeroCopyThreshold_;
+  // sequence number of next MSG_ZEROCOPY send, counted by kernel too
+  uint32_t zeroCopySequence_;
+  // chunks still referenced by kernel, in order of sequence number
+  std::deque<std::pair<uint32_t, BufferPtr>> zeroCopyInflight_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_BUFFERCHAIN_H
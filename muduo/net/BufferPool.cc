@@ -0,0 +1,148 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+
+#include "muduo/net/BufferPool.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const int BufferPool::kNumSizeClasses;
+const size_t BufferPool::kMinSize;
+const size_t BufferPool::kMaxSize;
+const size_t BufferPool::kDefaultMaxCachedBytes;
+
+namespace
+{
+const size_t kMaxShells = 4096;
+}
+
+BufferPool::BufferPool()
+  : maxCachedBytes_(kDefaultMaxCachedBytes),
+    cachedBytes_(0),
+    hits_(0),
+    misses_(0),
+    recycled_(0),
+    dropped_(0)
+{
+}
+
+BufferPool::~BufferPool() = default;
+
+int BufferPool::sizeClassOf(size_t size)
+{
+  int sizeClass = 0;
+  while (sizeClass < kNumSizeClasses - 1 && sizeOfClass(sizeClass) < size)
+  {
+    ++sizeClass;
+  }
+  return sizeClass;
+}
+
+BufferPtr BufferPool::get(size_t size)
+{
+  if (size <= kMaxSize)
+  {
+    std::vector<BufferPtr>& freeList = freeLists_[sizeClassOf(size)];
+    if (!freeList.empty())
+    {
+      ++hits_;
+      BufferPtr buf(std::move(freeList.back()));
+      freeList.pop_back();
+      cachedBytes_ -= buf->internalCapacity();
+      assert(buf->readableBytes() == 0);
+      assert(buf->writableBytes() >= size);
+      return buf;
+    }
+    size = sizeOfClass(sizeClassOf(size));
+  }
+  ++misses_;
+  return BufferPtr(new Buffer(size));
+}
+
+void BufferPool::put(BufferPtr buf)
+{
+  assert(buf.use_count() == 1);
+  buf->retrieveAll();
+  const size_t writable = buf->writableBytes();
+  if (writable < kMinSize)
+  {
+    // too small to be storage, keep it as shell if it has no storage
+    if (writable == 0 && shells_.size() < kMaxShells)
+    {
+      shells_.push_back(std::move(buf));
+    }
+    return;
+  }
+
+  const size_t capacity = buf->internalCapacity();
+  if (capacity > 2 * kMaxSize || cachedBytes_ + capacity > maxCachedBytes_)
+  {
+    ++dropped_;
+    return;
+  }
+
+  // the largest class it can serve
+  int sizeClass = sizeClassOf(writable);
+  if (sizeOfClass(sizeClass) > writable)
+  {
+    --sizeClass;
+  }
+  assert(sizeClass >= 0);
+  ++recycled_;
+  cachedBytes_ += capacity;
+  freeLists_[sizeClass].push_back(std::move(buf));
+}
+
+BufferPtr BufferPool::newShell()
+{
+  if (!shells_.empty())
+  {
+    BufferPtr shell(std::move(shells_.back()));
+    shells_.pop_back();
+    return shell;
+  }
+  return BufferPtr(new Buffer(0));
+}
+
+void BufferPool::acquire(Buffer* buf, size_t size)
+{
+  assert(buf->readableBytes() == 0);
+  BufferPtr storage(get(size));
+  buf->retrieveAll();
+  buf->swap(*storage);
+  put(std::move(storage));  // what buf had before
+}
+
+void BufferPool::release(Buffer* buf)
+{
+  assert(buf->readableBytes() == 0);
+  BufferPtr shell(newShell());
+  buf->retrieveAll();
+  buf->swap(*shell);
+  put(std::move(shell));  // now holds storage of buf
+}
+
+string BufferPool::toString() const
+{
+  string result;
+  char buf[256];
+  snprintf(buf, sizeof buf, "hits %" PRId64 " misses %" PRId64
+           " recycled %" PRId64 " dropped %" PRId64 " cached %zd bytes\n",
+           hits_, misses_, recycled_, dropped_, cachedBytes_);
+  result += buf;
+  for (int i = 0; i < kNumSizeClasses; ++i)
+  {
+    snprintf(buf, sizeof buf, "  %6zd: %zd\n", sizeOfClass(i), freeLists_[i].size());
+    result += buf;
+  }
+  return result;
+}
@@ -0,0 +1,88 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_BUFFERPOOL_H
+#define MUDUO_NET_BUFFERPOOL_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/Types.h"
+#include "muduo/net/BufferChain.h"
+
+#include <vector>
+
+namespace muduo
+{
+namespace net
+{
+
+///
+/// Size-classed free lists of Buffer storage, one per EventLoop.
+///
+/// Size classes are 1KiB, 2KiB, ... 64KiB of writable bytes.
+/// Not thread safe, must be used in the loop thread only.
+class BufferPool : noncopyable
+{
+ public:
+  static const int kNumSizeClasses = 7;
+  static const size_t kMinSize = 1024;
+  static const size_t kMaxSize = kMinSize << (kNumSizeClasses - 1);
+  static const size_t kDefaultMaxCachedBytes = 16*1024*1024;
+
+  BufferPool();
+  ~BufferPool();
+
+  /// Returns an empty chunk with writableBytes() >= @c size,
+  /// recycled from free list if possible.
+  BufferPtr get(size_t size);
+
+  /// Takes back a chunk got from get(), it must not be shared.
+  void put(BufferPtr buf);
+
+  /// Swaps pooled storage of at least @c size writable bytes into @c buf.
+  /// Require: buf->readableBytes() == 0
+  void acquire(Buffer* buf, size_t size);
+
+  /// Takes storage of @c buf back, leaves @c buf with no writable bytes.
+  /// Require: buf->readableBytes() == 0
+  void release(Buffer* buf);
+
+  void setMaxCachedBytes(size_t maxBytes)
+  { maxCachedBytes_ = maxBytes; }
+
+  size_t cachedBytes() const { return cachedBytes_; }
+  int64_t hits() const { return hits_; }
+  int64_t misses() const { return misses_; }
+  int64_t recycled() const { return recycled_; }
+  int64_t dropped() const { return dropped_; }
+
+  /// One line per size class, for diagnostic.
+  string toString() const;
+
+ private:
+  static int sizeClassOf(size_t size);  // smallest class can hold size
+  static size_t sizeOfClass(int sizeClass)
+  { return kMinSize << sizeClass; }
+
+  BufferPtr newShell();
+
+  std::vector<BufferPtr> freeLists_[kNumSizeClasses];
+  std::vector<BufferPtr> shells_;  // buffers without storage, for release()
+  size_t maxCachedBytes_;
+  size_t cachedBytes_;
+  int64_t hits_;
+  int64_t misses_;
+  int64_t recycled_;
+  int64_t dropped_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_BUFFERPOOL_H
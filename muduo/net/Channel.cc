@@ -28,6 +28,13 @@ Channel::Channel(EventLoop* loop, int fd__)
     revents_(0),
     index_(-1),
     logHup_(true),
+    edgeTriggered_(false),
+    registeredEvents_(kNoneEvent),
+    hasFixedRead_(false),
+    hasFixedWrite_(false),
+    fixedReadData_(NULL),
+    fixedReadResult_(0),
+    fixedWriteResult_(0),
     tied_(false),
     eventHandling_(false),
     addedToLoop_(false){
@@ -46,7 +53,19 @@ void Channel::tie(const std::shared_ptr<void>& obj){
   tied_ = true;
 }
 
+void Channel::setEdgeTriggered(bool on){
+  assert(!addedToLoop_);
+  edgeTriggered_ = on && loop_->supportsEdgeTriggered();
+}
+
 void Channel::update(){
+  // edge-triggered poller keeps write interest, only toggling it needs no update
+  if (edgeTriggered_ && addedToLoop_
+      && events_ != kNoneEvent && registeredEvents_ != kNoneEvent
+      && ((events_ ^ registeredEvents_) & ~kWriteEvent) == 0){
+    return;
+  }
+  registeredEvents_ = events_;
   addedToLoop_ = true;
   loop_->updateChannel(this); // 将该事件添加或者修改。
 }
@@ -54,6 +73,7 @@ void Channel::update(){
 void Channel::remove(){
   assert(isNoneEvent());
   addedToLoop_ = false;
+  registeredEvents_ = kNoneEvent;
   loop_->removeChannel(this);// 这里只是将channel从evnetLoop中移除，并不将负责channel的生存周期。
 }
 // 当事件到来会调用这个函数。
@@ -67,6 +87,10 @@ void Channel::handleEvent(Timestamp receiveTime){
   }else{
     handleEventWithGuard(receiveTime);
   }
+  // buffer of fixed read goes back to poller
+  hasFixedRead_ = false;
+  hasFixedWrite_ = false;
+  fixedReadData_ = NULL;
 }
 
 void Channel::handleEventWithGuard(Timestamp receiveTime){
@@ -95,7 +119,8 @@ void Channel::handleEventWithGuard(Timestamp receiveTime){
     if (readCallback_) readCallback_(receiveTime);
   }
   // pollout ： 这表示的是一个可写的事件。
-  if (revents_ & POLLOUT){
+  // edge-triggered channel always gets POLLOUT, even not writing
+  if ((revents_ & POLLOUT) && (!edgeTriggered_ || isWriting())){
     if (writeCallback_) writeCallback_();
   }
   eventHandling_ = false;       // 表示这个处理完成。
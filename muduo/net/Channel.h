@@ -17,6 +17,8 @@
 #include <functional>
 #include <memory>
 
+#include <sys/types.h>
+
 namespace muduo
 {
 namespace net
@@ -35,6 +37,8 @@ class Channel : noncopyable                                 // 都是不可拷
  public:
   typedef std::function<void()> EventCallback;                          // 事件的回调处理。
   typedef std::function<void(Timestamp)> ReadEventCallback;   // 读事件的回调处理。
+  /// Copies pending output into @c buf of @c len bytes, returns bytes copied.
+  typedef std::function<size_t(char* buf, size_t len)> FixedWriteCallback;
 
   //  一个 EventLoop 包含多个 channel。但是一个channel只能在一个EventLoop中处理。
   // 其中的 fd 就表示对应的事件，对应的文件描述符。
@@ -67,7 +71,37 @@ class Channel : noncopyable                                 // 都是不可拷
   bool isWriting() const { return events_ & kWriteEvent; }
   bool isReading() const { return events_ & kReadEvent; }
 
+  /// Edge-triggered mode, must be set before the channel is added to loop.
+  /// The poller keeps write interest registered for good, so enableWriting()
+  /// and disableWriting() cost no syscall, and the owner must read and write
+  /// until EAGAIN. No effect if the poller doesn't support it.
+  void setEdgeTriggered(bool on);
+  bool isEdgeTriggered() const { return edgeTriggered_; }
+
+  /// Lets a poller with EventLoop::supportsFixedBufferIo() read into and
+  /// write from its own registered buffers for this socket, instead of
+  /// reporting readiness. Results come with POLLIN and POLLOUT, see
+  /// hasFixedRead() and hasFixedWrite(), and the owner must take them
+  /// rather than read or write the fd. Pass an empty callback to stop.
+  void setFixedBufferIo(FixedWriteCallback cb)
+  { fixedWriteCallback_ = std::move(cb); }
+  bool fixedBufferIo() const { return static_cast<bool>(fixedWriteCallback_); }
+  size_t fillFixedWrite(char* buf, size_t len) { return fixedWriteCallback_(buf, len); }
+
+  /// In read callback, data was read by poller, valid till callback returns.
+  bool hasFixedRead() const { return hasFixedRead_; }
+  const char* fixedReadData() const { return fixedReadData_; }
+  /// Result of read(2), -errno on error.
+  ssize_t fixedReadResult() const { return fixedReadResult_; }
+  /// In write callback, poller wrote a copy of head of output.
+  bool hasFixedWrite() const { return hasFixedWrite_; }
+  ssize_t fixedWriteResult() const { return fixedWriteResult_; }
+
   // for Poller
+  void setFixedReadResult(const char* data, ssize_t n)
+  { hasFixedRead_ = true; fixedReadData_ = data; fixedReadResult_ = n; }
+  void setFixedWriteResult(ssize_t n)
+  { hasFixedWrite_ = true; fixedWriteResult_ = n; }
   int index() { return index_; }
   void set_index(int idx) { index_ = idx; }
 
@@ -97,6 +131,14 @@ class Channel : noncopyable                                 // 都是不可拷
   int        revents_; // it's the received event types of epoll or poll   实际返回的事件，实际返回的事件可能是和关注的有一定的出入。
   int        index_; // used by Poller.         表示poll的事件数组中的序号，就是我们关注的那个数组。小于 0 表示还没添加过去。
   bool       logHup_;
+  bool       edgeTriggered_;
+  int        registeredEvents_;  // events_ when poller was last updated
+  // results of fixed buffer I/O for this event, cleared after handling
+  bool       hasFixedRead_;
+  bool       hasFixedWrite_;
+  const char* fixedReadData_;
+  ssize_t    fixedReadResult_;
+  ssize_t    fixedWriteResult_;
 
   std::weak_ptr<void> tie_;  // 这是一个弱引用。
   bool tied_;
@@ -107,6 +149,7 @@ class Channel : noncopyable                                 // 都是不可拷
   EventCallback writeCallback_;
   EventCallback closeCallback_;
   EventCallback errorCallback_;
+  FixedWriteCallback fixedWriteCallback_;
 };
 
 }  // namespace net
@@ -9,7 +9,7 @@
 #include "muduo/net/EventLoop.h"
 
 #include "muduo/base/Logging.h"
-#include "muduo/base/Mutex.h"
+#include "muduo/net/BufferPool.h"
 #include "muduo/net/Channel.h"
 #include "muduo/net/Poller.h"
 #include "muduo/net/SocketsOps.h"
@@ -68,12 +68,20 @@ EventLoop::EventLoop()
     eventHandling_(false),
     callingPendingFunctors_(false),
     iteration_(0),
+    busyPollMicroSeconds_(0),
+    productivePolls_(0),
+    spinPolls_(0),
     threadId_(CurrentThread::tid()),      // 当前线程的真实id
     poller_(Poller::newDefaultPoller(this)),    // 相当于是在这里继承了，然后子进程就可以调用了。这里就用到了向上转型模式了。可以是poll也可以是epoll。
     timerQueue_(new TimerQueue(this)),    // 一开始就有这样一个队列了，只有它现在就注册。
+    bufferPool_(new BufferPool),
     wakeupFd_(createEventfd()),               // 创建了 eventfd 以及创建了Channel对象。
     wakeupChannel_(new Channel(this, wakeupFd_)),
-    currentActiveChannel_(NULL) {
+    currentActiveChannel_(NULL),
+    pendingFunctors_(NULL),
+    pendingCount_(0),
+    wakeupPending_(false),
+    numConnections_(0) {
   LOG_DEBUG << "EventLoop created " << this << " in thread " << threadId_;    // 记录日志。
   // 如果当前线程已经创建了EventLoop对象，则终止该程序。
   if (t_loopInThisThread){
@@ -96,6 +104,13 @@ EventLoop::~EventLoop(){
   wakeupChannel_->remove();
   ::close(wakeupFd_);
   t_loopInThisThread = NULL;
+  FunctorNode* node = pendingFunctors_.exchange(NULL);
+  while (node)
+  {
+    FunctorNode* next = node->next;
+    delete node;
+    node = next;
+  }
 }
 
 // 事件循环，该函数不能跨线程调用。
@@ -108,8 +123,22 @@ void EventLoop::loop(){
   while (!quit_){
     activeChannels_.clear();                                                            // 清空上一轮的活动通道。
     // 这里设置的超时时间是10s，如果超过了这个时间还是没有事件到来也会返回这个函数。
-    pollReturnTime_ = poller_->poll(kPollTimeMs, &activeChannels_); // 执行一次活跃事件的获取（只有活跃的事件），并返回一个时间戳。
+    // 忙轮询期间不阻塞。
+    const bool spin = busyPollMicroSeconds_ > 0 && pollReturnTime_ < busyPollUntil_;
+    pollReturnTime_ = poller_->poll(spin ? 0 : kPollTimeMs, &activeChannels_); // 执行一次活跃事件的获取（只有活跃的事件），并返回一个时间戳。
     ++iteration_;                                                                           // 记录事件循环的迭代次数。
+    if (!activeChannels_.empty())
+    {
+      ++productivePolls_;
+      if (busyPollMicroSeconds_ > 0)
+      {
+        busyPollUntil_ = addTime(pollReturnTime_, busyPollMicroSeconds_ * 1e-6);
+      }
+    }
+    else if (spin)
+    {
+      ++spinPolls_;
+    }
     if (Logger::logLevel() <= Logger::TRACE){       // 这里其实就是去判断当前日志的等级。
       printActiveChannels();                                                            // 打印活动通道。
     }
@@ -123,6 +152,7 @@ void EventLoop::loop(){
     eventHandling_ = false;                                                            // 标记当前没有通道在处理。
     // 这里一定不能无限的执行dopendingfunctors。通过这种方式可以实现线程安全的异步调用。
     doPendingFunctors();                                                               // 其他线程或者IO线程添加的一些任务，让IO线程也能执行一些计算任务。
+    doIterationFunctors();
   }
   LOG_TRACE << "EventLoop " << this << " stop looping";               // 这里就表示一个EventLoop停止了，并不表示被销毁了。
   looping_ = false;                                                                        // loop停止了。
@@ -149,21 +179,27 @@ void EventLoop::runInLoop(Functor cb){
 
 void EventLoop::queueInLoop(Functor cb)
 {
+  // 无锁入队，CAS 失败说明有其他线程同时入队，重试即可。
+  FunctorNode* node = new FunctorNode(std::move(cb));
+  FunctorNode* head = pendingFunctors_.load(std::memory_order_relaxed);
+  do
   {
-  // 需要通过互斥量保护临界区。
-  MutexLockGuard lock(mutex_);
-  pendingFunctors_.push_back(std::move(cb));        // 将要执行的函数添加到一个队列中，以便统一执行。
-  }
+    node->next = head;
+  } while (!pendingFunctors_.compare_exchange_weak(head, node));
+  pendingCount_.fetch_add(1, std::memory_order_relaxed);
   // 如果不是在本线程内，并且函数队列有函数需要执行，则唤醒eventloop线程。
   // 以下是需要唤醒的几种情况。如果是当前线程并且这在调用callingPendingFunctors也要唤醒（这种情况也就只有是IO线程中的pendingfunctors调用了wakeup）。
-  if (!isInLoopThread() || callingPendingFunctors_){
+  // 本轮已经有人唤醒过了，就不必再写eventfd。
+  if ((!isInLoopThread() || callingPendingFunctors_)
+      && !wakeupPending_.exchange(true)){
     wakeup();     // 唤醒的操作，也就是可以跳过poll函数的等待。
   }
 }
-size_t EventLoop::queueSize() const
+
+void EventLoop::runAfterIteration(int64_t iteration, Functor cb)
 {
-  MutexLockGuard lock(mutex_);
-  return pendingFunctors_.size();
+  assertInLoopThread();
+  iterationFunctors_.insert(std::make_pair(iteration, std::move(cb)));
 }
 // 通过eventloop的线程去增加定时器，主要是防止多个线程重复添加，这里也就可以更加充分的利用eventloop线程。
 TimerId EventLoop::runAt(Timestamp time, TimerCallback cb){
@@ -212,6 +248,16 @@ bool EventLoop::hasChannel(Channel* channel)
   return poller_->hasChannel(channel);
 }
 
+bool EventLoop::supportsEdgeTriggered() const
+{
+  return poller_->supportsEdgeTriggered();
+}
+
+bool EventLoop::supportsFixedBufferIo() const
+{
+  return poller_->supportsFixedBufferIo();
+}
+
 void EventLoop::abortNotInLoopThread()
 {
   LOG_FATAL << "EventLoop::abortNotInLoopThread - EventLoop " << this
@@ -239,23 +285,46 @@ void EventLoop::handleRead(){
 
 void EventLoop::doPendingFunctors()
 {
-  std::vector<Functor> functors;
   callingPendingFunctors_ = true;
+  // must be cleared before taking the queue, so that a functor queued
+  // after taking will write eventfd again.
+  wakeupPending_.store(false);
 
+  // 一次取走整个栈，缩短与queueInLoop()的竞争，然后反转成先进先出的顺序。
+  FunctorNode* node = pendingFunctors_.exchange(NULL);
+  FunctorNode* functors = NULL;
+  size_t count = 0;
+  while (node)
   {
-  MutexLockGuard lock(mutex_);
-  // 进行了一个交换，但是为什么要交换？减少了临界区的长度（也就是需要保护的区域），这样就不会阻塞其他线程queueinloop()，避免了死锁。
-  //
-  functors.swap(pendingFunctors_);
+    FunctorNode* next = node->next;
+    node->next = functors;
+    functors = node;
+    node = next;
+    ++count;
   }
+  pendingCount_.fetch_sub(count, std::memory_order_relaxed);
 
-  for (const Functor& functor : functors)
+  while (functors)
   {
-    functor();
+    std::unique_ptr<FunctorNode> guard(functors);
+    functors = functors->next;
+    guard->functor();
   }
   callingPendingFunctors_ = false;
 }
 
+void EventLoop::doIterationFunctors()
+{
+  // functors may add more, only run the due ones
+  while (!iterationFunctors_.empty()
+         && iterationFunctors_.begin()->first <= iteration_)
+  {
+    Functor functor(std::move(iterationFunctors_.begin()->second));
+    iterationFunctors_.erase(iterationFunctors_.begin());
+    functor();
+  }
+}
+
 void EventLoop::printActiveChannels() const
 {
   for (const Channel* channel : activeChannels_)
@@ -13,6 +13,8 @@
 
 #include <atomic>
 #include <functional>
+#include <map>
+#include <set>
 #include <vector>
 
 #include <boost/any.hpp>
@@ -28,6 +30,7 @@ namespace muduo
 namespace net
 {
 
+class BufferPool;
 class Channel;
 class Poller;
 class TimerQueue;
@@ -63,6 +66,18 @@ class EventLoop : noncopyable
   Timestamp pollReturnTime() const { return pollReturnTime_; }
 
   int64_t iteration() const { return iteration_; }
+  /// iteration() without the empty spins of busy polling.
+  int64_t workIteration() const { return iteration_ - spinPolls_; }
+
+  /// Polls with zero timeout for @c microseconds after the last poll
+  /// which returned events, before blocking in poll again.
+  /// Burns a CPU to save the sleep/wakeup latency of epoll_wait,
+  /// each spin is a loop iteration. 0 to disable (default).
+  /// Must be called in the loop thread.
+  void setBusyPoll(int microseconds) { busyPollMicroSeconds_ = microseconds; }
+  /// Polls which returned events, and zero-timeout polls which didn't.
+  int64_t productivePolls() const { return productivePolls_; }
+  int64_t spinPolls() const { return spinPolls_; }
 
   /// Runs callback immediately in the loop thread.
   /// It wakes up the loop, and run the cb.
@@ -71,10 +86,33 @@ class EventLoop : noncopyable
   void runInLoop(Functor cb);
   /// Queues callback in the loop thread.
   /// Runs after finish pooling.
-  /// Safe to call from other threads.
+  /// Safe to call from other threads, lock-free.
   void queueInLoop(Functor cb);
 
-  size_t queueSize() const;
+  /// Approximate number of queued functors.
+  size_t queueSize() const { return pendingCount_.load(std::memory_order_relaxed); }
+
+  /// Number of TcpConnection objects of this loop, as a load hint.
+  /// Safe to read from other threads.
+  int numConnections() const { return numConnections_.load(std::memory_order_relaxed); }
+  // internal usage, by TcpConnection
+  void addConnections(int delta) { numConnections_.fetch_add(delta, std::memory_order_relaxed); }
+
+  /// Established connections of this loop, for inspection.
+  /// Must be used in the loop thread.
+  const std::set<TcpConnection*>& establishedConnections() const
+  { return establishedConnections_; }
+  // internal usage, by TcpConnection in the loop thread
+  void addEstablished(TcpConnection* conn) { establishedConnections_.insert(conn); }
+  void removeEstablished(TcpConnection* conn) { establishedConnections_.erase(conn); }
+
+  /// Runs callback at the end of loop iteration @c iteration,
+  /// after pending functors, or at the end of current one if it has passed.
+  /// Must be called in the loop thread.
+  void runAfterIteration(int64_t iteration, Functor cb);
+
+  /// Buffer storage pool of this loop, use in the loop thread only.
+  BufferPool* bufferPool() { return bufferPool_.get(); }
 
   // timers
 
@@ -106,6 +144,8 @@ class EventLoop : noncopyable
   // 用于删除事件。
   void removeChannel(Channel* channel);
   bool hasChannel(Channel* channel);
+  bool supportsEdgeTriggered() const;
+  bool supportsFixedBufferIo() const;
 
   // pid_t threadId() const { return threadId_; }
   void assertInLoopThread()
@@ -135,21 +175,38 @@ class EventLoop : noncopyable
   void abortNotInLoopThread();
   void handleRead();  // waked up
   void doPendingFunctors();
+  void doIterationFunctors();
 
   void printActiveChannels() const; // DEBUG
 
   typedef std::vector<Channel*> ChannelList;
 
+  // intrusive node of pending functors
+  struct FunctorNode
+  {
+    explicit FunctorNode(Functor&& cb)
+      : functor(std::move(cb)), next(NULL)
+    { }
+
+    Functor functor;
+    FunctorNode* next;
+  };
+
   // looping和quit的区别是什么？
   bool looping_; /* atomic */                          // 标记IO事件是否处于循环监听的状态。
   std::atomic<bool> quit_;
   bool eventHandling_; /* atomic */
   bool callingPendingFunctors_; /* atomic */
   int64_t iteration_;
+  int busyPollMicroSeconds_;
+  Timestamp busyPollUntil_;
+  int64_t productivePolls_;
+  int64_t spinPolls_;
   const pid_t threadId_;                                  // 线程 id，记录当前对象属于哪一个线程，因为需要判断执行某些函数是否是在当前的线程中。
   Timestamp pollReturnTime_;                        // 调用poll函数返回的时间。
   std::unique_ptr<Poller> poller_;                    // 这是一个poll对象，它的生存期有eventloop来控制。
   std::unique_ptr<TimerQueue> timerQueue_;
+  std::unique_ptr<BufferPool> bufferPool_;
   // 这是一个事件文件描述符，用来管理 wakeupChannel_，主要的目的是为了处理一些多线程的任务同时也防止eventloop一直处理空闲状态。
   int wakeupFd_;
   // unlike in TimerQueue, which is an internal class,
@@ -161,8 +218,18 @@ class EventLoop : noncopyable
   ChannelList activeChannels_;                      // poller返回的活动对象，产生的活动事件。
   Channel* currentActiveChannel_;                 // 当前这在处理的活动通道。
 
-  mutable MutexLock mutex_;
-  std::vector<Functor> pendingFunctors_ GUARDED_BY(mutex_);
+  // keyed by iteration, always in loop thread
+  std::multimap<int64_t, Functor> iterationFunctors_;
+  // between connectEstablished() and connectDestroyed(), always in loop thread
+  std::set<TcpConnection*> establishedConnections_;
+
+  // MPSC queue: producers push onto a lock-free stack,
+  // the loop thread takes the whole stack and runs it in FIFO order.
+  std::atomic<FunctorNode*> pendingFunctors_;
+  std::atomic<size_t> pendingCount_;
+  // at most one eventfd write per iteration, no matter how many producers
+  std::atomic<bool> wakeupPending_;
+  std::atomic<int> numConnections_;
 };
 
 }  // namespace net
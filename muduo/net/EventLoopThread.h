@@ -29,6 +29,10 @@ class EventLoopThread : noncopyable{
   EventLoopThread(const ThreadInitCallback& cb = ThreadInitCallback(),
                   const string& name = string());
   ~EventLoopThread();
+  /// The loop and its Buffer storage are created after placement,
+  /// so they come from memory of that node.
+  /// Must be called before startLoop().
+  void setAffinity(const ThreadAffinity& affinity) { thread_.setAffinity(affinity); }
   EventLoop* startLoop();                             // 启动线程，该线程就成为了IO线程。
 
  private:
@@ -21,7 +21,9 @@ EventLoopThreadPool::EventLoopThreadPool(EventLoop* baseLoop, const string& name
     name_(nameArg),
     started_(false),
     numThreads_(0),
-    next_(0)
+    next_(0),
+    loadBalance_(kRoundRobin),
+    randomState_(2463534242u)
 {
 }
 
@@ -41,6 +43,10 @@ void EventLoopThreadPool::start(const ThreadInitCallback& cb)
     snprintf(buf, sizeof buf, "%s%d", name_.c_str(), i);
     EventLoopThread* t = new EventLoopThread(cb, buf);  // 创建这么多个EventLoopThread线程，还没有启动。
     threads_.push_back(std::unique_ptr<EventLoopThread>(t));  // 获取管理权限。
+    if (!affinities_.empty())
+    {
+      t->setAffinity(affinities_[i % affinities_.size()]);
+    }
     loops_.push_back(t->startLoop());                              // 线程启动之前会先调用cd函数。
   }
   if (numThreads_ == 0 && cb)
@@ -56,19 +62,76 @@ EventLoop* EventLoopThreadPool::getNextLoop()
   assert(started_);
   EventLoop* loop = baseLoop_;
   // 如果有线程IO则，循环遍历这个列表，选择合理的线程IO去处理这个连接。
-  if (!loops_.empty())
+  if (loops_.empty())
+  {
+    return loop;
+  }
+
+  switch (loadBalance_)
   {
-    // round-robin，轮叫的方式选择loop
-    loop = loops_[next_];
-    ++next_;
-    if (implicit_cast<size_t>(next_) >= loops_.size())
+    case kLeastConnections:
+    case kLeastQueueSize:
     {
-      next_ = 0;
+      // start from next_, so that ties are broken round-robin
+      size_t best = 0;
+      for (size_t i = 0; i < loops_.size(); ++i)
+      {
+        EventLoop* candidate = loops_[(next_ + i) % loops_.size()];
+        size_t load = loadOf(candidate);
+        if (i == 0 || load < best)
+        {
+          best = load;
+          loop = candidate;
+        }
+      }
+      advance();
+      break;
     }
+    case kPowerOfTwoChoices:
+    {
+      // two distinct loops
+      const size_t n = loops_.size();
+      const size_t i = nextRandom() % n;
+      const size_t j = n > 1 ? (i + 1 + nextRandom() % (n - 1)) % n : i;
+      EventLoop* a = loops_[i];
+      EventLoop* b = loops_[j];
+      loop = b->numConnections() < a->numConnections() ? b : a;
+      break;
+    }
+    default:
+      // round-robin，轮叫的方式选择loop
+      loop = loops_[next_];
+      advance();
+      break;
   }
   return loop;
 }
 
+size_t EventLoopThreadPool::loadOf(const EventLoop* loop) const
+{
+  return loadBalance_ == kLeastQueueSize
+      ? loop->queueSize()
+      : implicit_cast<size_t>(loop->numConnections());
+}
+
+void EventLoopThreadPool::advance()
+{
+  ++next_;
+  if (implicit_cast<size_t>(next_) >= loops_.size())
+  {
+    next_ = 0;
+  }
+}
+
+uint32_t EventLoopThreadPool::nextRandom()
+{
+  // xorshift32, only in base loop thread
+  randomState_ ^= randomState_ << 13;
+  randomState_ ^= randomState_ >> 17;
+  randomState_ ^= randomState_ << 5;
+  return randomState_;
+}
+
 EventLoop* EventLoopThreadPool::getLoopForHash(size_t hashCode)
 {
   baseLoop_->assertInLoopThread();
@@ -12,6 +12,7 @@
 #define MUDUO_NET_EVENTLOOPTHREADPOOL_H
 
 #include "muduo/base/noncopyable.h"
+#include "muduo/base/ThreadAffinity.h"
 #include "muduo/base/Types.h"
 
 #include <functional>
@@ -32,13 +33,31 @@ class EventLoopThreadPool : noncopyable
  public:
   typedef std::function<void(EventLoop*)> ThreadInitCallback;
 
+  /// How getNextLoop() places new connections.
+  enum LoadBalance
+  {
+    kRoundRobin,
+    kLeastConnections,   // fewest EventLoop::numConnections()
+    kLeastQueueSize,     // fewest pending functors, EventLoop::queueSize()
+    kPowerOfTwoChoices,  // fewer connections of two loops picked at random
+  };
+
   EventLoopThreadPool(EventLoop* baseLoop, const string& nameArg);
   ~EventLoopThreadPool();
   void setThreadNum(int numThreads) { numThreads_ = numThreads; }
+  /// Default kRoundRobin. The least-* ones scan all loops, O(loops) on
+  /// purpose: the counters are atomics bumped by each loop thread, a shared
+  /// min-heap would need a lock on every connection and functor. Ties are
+  /// broken round-robin. kPowerOfTwoChoices looks at two only.
+  void setLoadBalance(LoadBalance loadBalance) { loadBalance_ = loadBalance; }
+  /// Loop i runs on affinities[i % size], e.g. ThreadAffinity::perNode()
+  /// spreads loops across NUMA nodes. Must be called before start().
+  void setThreadAffinity(const std::vector<ThreadAffinity>& affinities)
+  { affinities_ = affinities; }
   void start(const ThreadInitCallback& cb = ThreadInitCallback());
 
   // valid after calling start()
-  /// round-robin
+  /// by the LoadBalance strategy, round-robin by default
   EventLoop* getNextLoop();
 
   /// with the same hash code, it will always return the same EventLoop
@@ -53,12 +72,19 @@ class EventLoopThreadPool : noncopyable
   { return name_; }
 
  private:
+  size_t loadOf(const EventLoop* loop) const;
+  void advance();
+  uint32_t nextRandom();
+
   // 可以粗略的理解，主IO是用来监听Tcp连接的并且合理分配给其他子IO线程来处理的。
   EventLoop* baseLoop_;   // 与Acceptor所属相同的EventLoop对象/
   string name_;
   bool started_;
   int numThreads_;            // 线程的数量。
   int next_;                        // 新连接到来，所选择的EventLoop对象下标。
+  LoadBalance loadBalance_;
+  uint32_t randomState_;            // xorshift for kPowerOfTwoChoices
+  std::vector<ThreadAffinity> affinities_;
   std::vector<std::unique_ptr<EventLoopThread>> threads_;     // IO线程列表。
   std::vector<EventLoop*> loops_;                                        // EventLoop列表。
 };
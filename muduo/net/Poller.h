@@ -50,6 +50,12 @@ class Poller : noncopyable
 
   virtual bool hasChannel(Channel* channel) const;
 
+  /// Whether Channel::setEdgeTriggered() takes effect.
+  virtual bool supportsEdgeTriggered() const { return false; }
+
+  /// Whether Channel::setFixedBufferIo() takes effect.
+  virtual bool supportsFixedBufferIo() const { return false; }
+
   static Poller* newDefaultPoller(EventLoop* loop);// 这样在一个线程中就只会有一个poller对象了，也就是所谓的单例模式。
 
   void assertInLoopThread() const
@@ -80,6 +80,11 @@ class Socket : noncopyable
   ///
   void setKeepAlive(bool on);
 
+  ///
+  /// Enable/disable SO_ZEROCOPY, returns false if the kernel doesn't support it.
+  ///
+  bool setZeroCopy(bool on);
+
  private:
   const int sockfd_;    // 文件描述符。
 };
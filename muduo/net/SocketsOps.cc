@@ -15,8 +15,9 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>  // snprintf
+#include <sys/sendfile.h>
 #include <sys/socket.h>
-#include <sys/uio.h>  // readv
+#include <sys/uio.h>  // readv, writev
 #include <unistd.h>
 
 using namespace muduo;
@@ -91,6 +92,16 @@ int sockets::createNonblockingOrDie(sa_family_t family)
   return sockfd;
 }
 
+int sockets::createUdpNonblockingOrDie(sa_family_t family)
+{
+  int sockfd = ::socket(family, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_UDP);
+  if (sockfd < 0)
+  {
+    LOG_SYSFATAL << "sockets::createUdpNonblockingOrDie";
+  }
+  return sockfd;
+}
+
 void sockets::bindOrDie(int sockfd, const struct sockaddr* addr)
 {
   int ret = ::bind(sockfd, addr, static_cast<socklen_t>(sizeof(struct sockaddr_in6)));
@@ -121,7 +132,10 @@ int sockets::accept(int sockfd, struct sockaddr_in6* addr)
 #endif
   if (connfd < 0){      // 如果出错了。
     int savedErrno = errno;
-    LOG_SYSERR << "Socket::accept";
+    if (savedErrno != EAGAIN)   // backlog drained, normal for an accept loop
+    {
+      LOG_SYSERR << "Socket::accept";
+    }
     switch (savedErrno)
     {
       case EAGAIN:
@@ -172,6 +186,16 @@ ssize_t sockets::write(int sockfd, const void *buf, size_t count)
   return ::write(sockfd, buf, count);
 }
 
+ssize_t sockets::writev(int sockfd, const struct iovec *iov, int iovcnt)
+{
+  return ::writev(sockfd, iov, iovcnt);
+}
+
+ssize_t sockets::sendfile(int sockfd, int infd, off_t* offset, size_t count)
+{
+  return ::sendfile(sockfd, infd, offset, count);
+}
+
 void sockets::close(int sockfd)
 {
   if (::close(sockfd) < 0)
@@ -25,6 +25,8 @@ namespace sockets
 /// abort if any error.
 // 创建非阻塞的套接字。
 int createNonblockingOrDie(sa_family_t family);
+/// Same as above, but a UDP socket.
+int createUdpNonblockingOrDie(sa_family_t family);
 
 int  connect(int sockfd, const struct sockaddr* addr);
 // 绑定和监听。
@@ -34,6 +36,9 @@ int  accept(int sockfd, struct sockaddr_in6* addr);
 ssize_t read(int sockfd, void *buf, size_t count);
 ssize_t readv(int sockfd, const struct iovec *iov, int iovcnt);
 ssize_t write(int sockfd, const void *buf, size_t count);
+ssize_t writev(int sockfd, const struct iovec *iov, int iovcnt);
+/// sends @c count bytes of @c infd at @c *offset, with sendfile(2).
+ssize_t sendfile(int sockfd, int infd, off_t* offset, size_t count);
 void close(int sockfd);
 void shutdownWrite(int sockfd);
 
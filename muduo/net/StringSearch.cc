@@ -0,0 +1,201 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/StringSearch.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define MUDUO_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace muduo::net;
+
+namespace
+{
+
+typedef const char* (*FindFunc)(const char*, const char*, const char*, size_t);
+
+const char* findScalar(const char* begin, const char* end,
+                       const char* delim, size_t delimLen)
+{
+  const char* last = end - delimLen + 1;  // last candidate + 1
+  const char* p = begin;
+  while (p < last)
+  {
+    p = static_cast<const char*>(::memchr(p, delim[0], last - p));
+    if (p == NULL)
+    {
+      return NULL;
+    }
+    if (::memcmp(p + 1, delim + 1, delimLen - 1) == 0)
+    {
+      return p;
+    }
+    ++p;
+  }
+  return NULL;
+}
+
+#ifdef MUDUO_SEARCH_X86
+
+// candidates of mask are where both the first and the last byte match,
+// bytes in between are compared for delimiters longer than 2.
+inline const char* checkCandidates(unsigned mask, const char* p,
+                                   const char* delim, size_t delimLen)
+{
+  while (mask != 0)
+  {
+    const int i = __builtin_ctz(mask);
+    if (delimLen <= 2 || ::memcmp(p + i + 1, delim + 1, delimLen - 2) == 0)
+    {
+      return p + i;
+    }
+    mask &= mask - 1;
+  }
+  return NULL;
+}
+
+__attribute__((target("sse2")))
+const char* findSse2(const char* begin, const char* end,
+                     const char* delim, size_t delimLen)
+{
+  const __m128i first = _mm_set1_epi8(delim[0]);
+  const __m128i last = _mm_set1_epi8(delim[delimLen - 1]);
+  const char* p = begin;
+  for (; end - p >= static_cast<ptrdiff_t>(16 + delimLen - 1); p += 16)
+  {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + delimLen - 1));
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))));
+    const char* found = checkCandidates(mask, p, delim, delimLen);
+    if (found)
+    {
+      return found;
+    }
+  }
+  return findScalar(p, end, delim, delimLen);
+}
+
+__attribute__((target("avx2")))
+const char* findAvx2(const char* begin, const char* end,
+                     const char* delim, size_t delimLen)
+{
+  const __m256i first = _mm256_set1_epi8(delim[0]);
+  const __m256i last = _mm256_set1_epi8(delim[delimLen - 1]);
+  const char* p = begin;
+  for (; end - p >= static_cast<ptrdiff_t>(32 + delimLen - 1); p += 32)
+  {
+    const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + delimLen - 1));
+    const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))));
+    const char* found = checkCandidates(mask, p, delim, delimLen);
+    if (found)
+    {
+      return found;
+    }
+  }
+  // less than a vector left
+  return findSse2(p, end, delim, delimLen);
+}
+
+#endif  // MUDUO_SEARCH_X86
+
+bool supported(search::Kernel kernel)
+{
+#ifdef MUDUO_SEARCH_X86
+  __builtin_cpu_init();
+  switch (kernel)
+  {
+    case search::kAvx2:
+      return __builtin_cpu_supports("avx2");
+    case search::kSse2:
+      return __builtin_cpu_supports("sse2");
+    default:
+      return true;
+  }
+#else
+  return kernel == search::kScalar;
+#endif
+}
+
+FindFunc funcOf(search::Kernel kernel)
+{
+#ifdef MUDUO_SEARCH_X86
+  if (kernel == search::kAvx2 && supported(kernel))
+  {
+    return findAvx2;
+  }
+  if (kernel == search::kSse2 && supported(kernel))
+  {
+    return findSse2;
+  }
+#endif
+  return findScalar;
+}
+
+FindFunc bestFunc()
+{
+  static const FindFunc func = funcOf(search::bestKernel());
+  return func;
+}
+
+}  // namespace
+
+search::Kernel search::bestKernel()
+{
+  if (supported(kAvx2))
+  {
+    return kAvx2;
+  }
+  return supported(kSse2) ? kSse2 : kScalar;
+}
+
+const char* search::kernelName(Kernel kernel)
+{
+  switch (kernel)
+  {
+    case kAvx2:
+      return "avx2";
+    case kSse2:
+      return "sse2";
+    default:
+      return "scalar";
+  }
+}
+
+const char* search::find(const char* begin, const char* end,
+                         const char* delim, size_t delimLen)
+{
+  if (delimLen == 0)
+  {
+    return begin;
+  }
+  if (static_cast<size_t>(end - begin) < delimLen)
+  {
+    return NULL;
+  }
+  return bestFunc()(begin, end, delim, delimLen);
+}
+
+const char* search::findWith(Kernel kernel, const char* begin, const char* end,
+                             const char* delim, size_t delimLen)
+{
+  if (delimLen == 0)
+  {
+    return begin;
+  }
+  if (static_cast<size_t>(end - begin) < delimLen)
+  {
+    return NULL;
+  }
+  return funcOf(kernel)(begin, end, delim, delimLen);
+}
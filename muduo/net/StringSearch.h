@@ -0,0 +1,56 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_STRINGSEARCH_H
+#define MUDUO_NET_STRINGSEARCH_H
+
+#include <stddef.h>
+
+namespace muduo
+{
+namespace net
+{
+
+///
+/// Delimiter search for protocol parsers, used by Buffer::findCRLF()
+/// and Buffer::findDelimiter().
+///
+/// Candidates are found by comparing 16 or 32 bytes at a time against the
+/// first and the last byte of the delimiter, then checked with memcmp().
+/// The kernel is picked once at runtime from what the CPU supports.
+namespace search
+{
+
+enum Kernel
+{
+  kScalar,  // memchr() for the first byte, then memcmp()
+  kSse2,
+  kAvx2,
+};
+
+/// Best kernel of this CPU.
+Kernel bestKernel();
+const char* kernelName(Kernel kernel);
+
+/// First occurrence of @c delim in [begin, end), NULL if not found,
+/// with the best kernel. An empty delimiter is found at @c begin.
+const char* find(const char* begin, const char* end,
+                 const char* delim, size_t delimLen);
+
+/// Same as find(), with a given kernel, for tests and benchmarks.
+/// Falls back to kScalar if the CPU doesn't support it.
+const char* findWith(Kernel kernel, const char* begin, const char* end,
+                     const char* delim, size_t delimLen);
+
+}  // namespace search
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_STRINGSEARCH_H
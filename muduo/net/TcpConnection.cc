@@ -10,12 +10,17 @@
 
 #include "muduo/base/Logging.h"
 #include "muduo/base/WeakCallback.h"
+#include "muduo/net/BufferPool.h"
 #include "muduo/net/Channel.h"
 #include "muduo/net/EventLoop.h"
 #include "muduo/net/Socket.h"
 #include "muduo/net/SocketsOps.h"
 
 #include <errno.h>
+#include <limits.h>
+#include <sys/uio.h>
+
+#include <algorithm>
 
 using namespace muduo;
 using namespace muduo::net;
@@ -47,7 +52,21 @@ TcpConnection::TcpConnection(EventLoop* loop,
     channel_(new Channel(loop, sockfd)),  // 生成channel。
     localAddr_(localAddr),
     peerAddr_(peerAddr),
-    highWaterMark_(64*1024*1024)
+    highWaterMark_(64*1024*1024),
+    idleBufferIterations_(0),
+    idleCheckPending_(false),
+    lastReadIteration_(0),
+    corking_(false),
+    corkPending_(false),
+    corkedSends_(0),
+    inputBuffer_(0),   // storage comes from loop's BufferPool in connectEstablished()
+    creationTime_(Timestamp::now()),
+    bytesReceived_(0),
+    bytesSent_(0),
+    readCalls_(0),
+    writeCalls_(0),
+    outputHighWaterMark_(0),
+    writesSaved_(0)
 {
   // 设置通道的处理事件。
   channel_->setReadCallback(
@@ -62,6 +81,15 @@ TcpConnection::TcpConnection(EventLoop* loop,
   LOG_DEBUG << "TcpConnection::ctor[" <<  name_ << "] at " << this
             << " fd=" << sockfd;
   socket_->setKeepAlive(true);
+  outputBuffer_.setBufferPool(loop_->bufferPool());
+  if (loop_->supportsFixedBufferIo())
+  {
+    // poller reads into and writes from its registered buffers
+    channel_->setFixedBufferIo(
+        std::bind(&BufferChain::copyOut, &outputBuffer_, _1, _2));
+  }
+  // counted as soon as assigned, so a burst of new connections sees it
+  loop_->addConnections(1);
 }
 
 TcpConnection::~TcpConnection()
@@ -70,6 +98,7 @@ TcpConnection::~TcpConnection()
             << " fd=" << channel_->fd()
             << " state=" << stateToString();
   assert(state_ == kDisconnected);
+  loop_->addConnections(-1);
 }
 
 bool TcpConnection::getTcpInfo(struct tcp_info* tcpi) const
@@ -101,12 +130,43 @@ void TcpConnection::send(const StringPiece& message)
           std::bind(fp,
                     this,     // FIXME
                     message.as_string()));
-                    //std::forward<string>(message)));
     }
   }
 }
 
-// FIXME efficiency!!!
+void TcpConnection::send(string&& message)
+{
+  if (state_ == kConnected){
+    if (loop_->isInLoopThread()){
+      sendInLoop(message);
+    }else{
+      void (TcpConnection::*fp)(const StringPiece& message) = &TcpConnection::sendInLoop;
+      loop_->runInLoop(
+          std::bind(fp,
+                    this,     // FIXME
+                    std::move(message)));
+    }
+    // moved-from is unspecified, be sure
+    message.clear();
+  }
+}
+
+void TcpConnection::send(Buffer&& message)
+{
+  if (state_ == kConnected){
+    BufferPtr chunk(new Buffer(0));
+    chunk->swap(message);
+    if (loop_->isInLoopThread()){
+      sendChunkInLoop(chunk);
+    }else{
+      loop_->runInLoop(
+          std::bind(&TcpConnection::sendChunkInLoop,
+                    this,     // FIXME
+                    chunk));
+    }
+  }
+}
+
 // 可以是一个buffer
 void TcpConnection::send(Buffer* buf)
 {
@@ -115,12 +175,37 @@ void TcpConnection::send(Buffer* buf)
       sendInLoop(buf->peek(), buf->readableBytes());
       buf->retrieveAll();
     }else{
-      void (TcpConnection::*fp)(const StringPiece& message) = &TcpConnection::sendInLoop;
+      // 跨线程时交换出数据，不再复制。
+      BufferPtr chunk(new Buffer(0));
+      chunk->swap(*buf);
       loop_->runInLoop(
-          std::bind(fp,
+          std::bind(&TcpConnection::sendChunkInLoop,
+                    this,     // FIXME
+                    chunk));
+    }
+  }
+}
+
+void TcpConnection::send(const std::vector<StringPiece>& pieces)
+{
+  if (state_ == kConnected){
+    if (loop_->isInLoopThread()){
+      sendInLoop(pieces);
+    }else{
+      size_t len = 0;
+      for (const StringPiece& piece : pieces)
+      {
+        len += piece.size();
+      }
+      BufferPtr chunk(new Buffer(len));
+      for (const StringPiece& piece : pieces)
+      {
+        chunk->append(piece);
+      }
+      loop_->runInLoop(
+          std::bind(&TcpConnection::sendChunkInLoop,
                     this,     // FIXME
-                    buf->retrieveAllAsString()));
-                    //std::forward<string>(message)));
+                    chunk));
     }
   }
 }
@@ -133,51 +218,203 @@ void TcpConnection::sendInLoop(const StringPiece& message)
 void TcpConnection::sendInLoop(const void* data, size_t len)
 {
   loop_->assertInLoopThread();// 也会断言一下。
-  ssize_t nwrote = 0;
-  size_t remaining = len;
-  bool faultError = false;
   if (state_ == kDisconnected){
     LOG_WARN << "disconnected, give up writing";
     return;
   }
-  // if no thing in output queue, try writing directly
-  if (!channel_->isWriting() && outputBuffer_.readableBytes() == 0){
-    nwrote = sockets::write(channel_->fd(), data, len);
-    if (nwrote >= 0){
-      remaining = len - nwrote;
-      if (remaining == 0 && writeCompleteCallback_){
-        loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
-      }
-    }else // nwrote < 0
+  struct iovec vec;
+  vec.iov_base = const_cast<void*>(data);
+  vec.iov_len = len;
+  size_t nwrote = 0;
+  if (writeDirectly(&vec, 1, len, &nwrote) && nwrote < len)
+  {
+    size_t oldLen = outputBuffer_.readableBytes();
+    outputBuffer_.append(static_cast<const char*>(data)+nwrote, len-nwrote);
+    outputAppended(oldLen);
+  }
+}
+
+void TcpConnection::sendInLoop(const std::vector<StringPiece>& pieces)
+{
+  loop_->assertInLoopThread();
+  if (state_ == kDisconnected){
+    LOG_WARN << "disconnected, give up writing";
+    return;
+  }
+  // pieces beyond IOV_MAX are queued below
+  const int count = static_cast<int>(std::min(pieces.size(), static_cast<size_t>(IOV_MAX)));
+  std::vector<struct iovec> vec(count);
+  size_t len = 0;
+  for (int i = 0; i < count; ++i)
+  {
+    vec[i].iov_base = const_cast<char*>(pieces[i].data());
+    vec[i].iov_len = pieces[i].size();
+    len += pieces[i].size();
+  }
+  for (size_t i = count; i < pieces.size(); ++i)
+  {
+    len += pieces[i].size();
+  }
+  size_t nwrote = 0;
+  if (writeDirectly(vec.data(), count, len, &nwrote) && nwrote < len)
+  {
+    size_t oldLen = outputBuffer_.readableBytes();
+    for (const StringPiece& piece : pieces)
     {
-      nwrote = 0;
-      if (errno != EWOULDBLOCK){
-        LOG_SYSERR << "TcpConnection::sendInLoop";
-        if (errno == EPIPE || errno == ECONNRESET) // FIXME: any others?
-        {
-          faultError = true;
-        }
-      }
+      const size_t n = std::min(nwrote, static_cast<size_t>(piece.size()));
+      nwrote -= n;
+      outputBuffer_.append(piece.data() + n, piece.size() - n);
     }
+    outputAppended(oldLen);
   }
+}
 
-  assert(remaining <= len);
-  if (!faultError && remaining > 0)
+void TcpConnection::sendChunkInLoop(const BufferPtr& chunk)
+{
+  loop_->assertInLoopThread();
+  if (state_ == kDisconnected){
+    LOG_WARN << "disconnected, give up writing";
+    return;
+  }
+  if (outputBuffer_.zeroCopyThreshold() > 0
+      && chunk->readableBytes() >= outputBuffer_.zeroCopyThreshold())
   {
+    // goes through output buffer, which pins it until completion
     size_t oldLen = outputBuffer_.readableBytes();
-    if (oldLen + remaining >= highWaterMark_
-        && oldLen < highWaterMark_
-        && highWaterMarkCallback_)
+    outputBuffer_.append(chunk);
+    writeAppended(oldLen);
+    return;
+  }
+  struct iovec vec;
+  vec.iov_base = const_cast<char*>(chunk->peek());
+  vec.iov_len = chunk->readableBytes();
+  size_t nwrote = 0;
+  if (writeDirectly(&vec, 1, vec.iov_len, &nwrote) && nwrote < vec.iov_len)
+  {
+    chunk->retrieve(nwrote);
+    size_t oldLen = outputBuffer_.readableBytes();
+    outputBuffer_.append(chunk);
+    outputAppended(oldLen);
+  }
+}
+
+// if no thing in output queue, try writing directly.
+// returns false on fault error, @c nwrote is what has been written.
+bool TcpConnection::writeDirectly(const struct iovec* vec, int count, size_t len, size_t* nwrote)
+{
+  *nwrote = 0;
+  if (corking_ || channel_->isWriting() || outputBuffer_.readableBytes() != 0){
+    return true;
+  }
+  ssize_t n = count == 1 ? sockets::write(channel_->fd(), vec[0].iov_base, vec[0].iov_len)
+                         : sockets::writev(channel_->fd(), vec, count);
+  countWrite(n);
+  if (n >= 0){
+    *nwrote = n;
+    assert(*nwrote <= len);
+    if (*nwrote == len && writeCompleteCallback_){
+      loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+    }
+  }else // n < 0
+  {
+    if (errno != EWOULDBLOCK){
+      LOG_SYSERR << "TcpConnection::sendInLoop";
+      if (errno == EPIPE || errno == ECONNRESET) // FIXME: any others?
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// output buffer grew from @c oldLen, wait for writable
+void TcpConnection::outputAppended(size_t oldLen)
+{
+  size_t newLen = outputBuffer_.readableBytes();
+  outputHighWaterMark_ = std::max(outputHighWaterMark_, newLen);
+  if (newLen >= highWaterMark_
+      && oldLen < highWaterMark_
+      && highWaterMarkCallback_)
+  {
+    loop_->queueInLoop(std::bind(highWaterMarkCallback_, shared_from_this(), newLen));
+  }
+  if (channel_->isWriting())
+  {
+    // handleWrite() takes it
+  }
+  else if (corking_)
+  {
+    ++corkedSends_;
+    if (!corkPending_)
+    {
+      corkPending_ = true;
+      loop_->runAfterIteration(
+          loop_->iteration(),
+          makeWeakCallback(shared_from_this(), &TcpConnection::flushCorked));
+    }
+  }
+  else
+  {
+    channel_->enableWriting();
+  }
+}
+
+void TcpConnection::sendFile(int fd, int64_t offset, size_t length)
+{
+  if (state_ == kConnected)
+  {
+    FileRegionPtr file(new FileRegion(fd, offset, length));
+    loop_->runInLoop(
+        std::bind(&TcpConnection::sendFileInLoop,
+                  this,     // FIXME
+                  file));
+  }
+}
+
+void TcpConnection::sendFileInLoop(const FileRegionPtr& file)
+{
+  loop_->assertInLoopThread();
+  if (state_ == kDisconnected)
+  {
+    LOG_WARN << "disconnected, give up sending file";
+    return;
+  }
+  size_t oldLen = outputBuffer_.readableBytes();
+  outputBuffer_.append(file);
+  writeAppended(oldLen);
+}
+
+// output buffer grew from @c oldLen, try sending directly if it was empty
+void TcpConnection::writeAppended(size_t oldLen)
+{
+  bool faultError = false;
+  if (!corking_ && !channel_->isWriting() && oldLen == 0)
+  {
+    int savedErrno = 0;
+    ssize_t n = outputBuffer_.writeFd(channel_->fd(), &savedErrno);
+    countWrite(n);
+    if (n < 0 && savedErrno != EWOULDBLOCK)
     {
-      loop_->queueInLoop(std::bind(highWaterMarkCallback_, shared_from_this(), oldLen + remaining));
+      errno = savedErrno;
+      LOG_SYSERR << "TcpConnection::writeAppended";
+      if (errno == EPIPE || errno == ECONNRESET)
+      {
+        faultError = true;
+      }
     }
-    outputBuffer_.append(static_cast<const char*>(data)+nwrote, remaining);
-    if (!channel_->isWriting())
+    if (outputBuffer_.empty() && writeCompleteCallback_)
     {
-      channel_->enableWriting();
+      loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
     }
   }
+
+  if (!faultError && !outputBuffer_.empty())
+  {
+    outputAppended(oldLen);
+  }
 }
+
 // 表示的是服务端的应用层想关闭连接。
 // 客户端想要关闭我们就会收到pollhup
 void TcpConnection::shutdown()
@@ -193,7 +430,7 @@ void TcpConnection::shutdown()
 void TcpConnection::shutdownInLoop()
 {
   loop_->assertInLoopThread();
-  if (!channel_->isWriting()){          // 也就是表示它不能够执行写操作了。这一个一般是处于关注pollout事件才会有。
+  if (!channel_->isWriting() && !corkPending_){          // 也就是表示它不能够执行写操作了。这一个一般是处于关注pollout事件才会有。
     // we are not writing
     socket_->shutdownWrite();       // 因为这里操作的是套接字，因此对方也能收到。
   }
@@ -278,6 +515,41 @@ void TcpConnection::setTcpNoDelay(bool on)
   socket_->setTcpNoDelay(on);
 }
 
+void TcpConnection::setEdgeTriggered(bool on)
+{
+  assert(state_ == kConnecting);
+  channel_->setEdgeTriggered(on);
+}
+
+bool TcpConnection::isEdgeTriggered() const
+{
+  return channel_->isEdgeTriggered();
+}
+
+void TcpConnection::setZeroCopyThreshold(size_t bytes)
+{
+  loop_->assertInLoopThread();
+  if (bytes > 0 && outputBuffer_.zeroCopyThreshold() == 0
+      && !socket_->setZeroCopy(true))
+  {
+    LOG_WARN << "TcpConnection::setZeroCopyThreshold [" << name_
+             << "] - MSG_ZEROCOPY is not available, keep copying";
+    return;
+  }
+  if (bytes > 0)
+  {
+    // a copy into poller's buffer defeats MSG_ZEROCOPY
+    channel_->setFixedBufferIo(Channel::FixedWriteCallback());
+  }
+  outputBuffer_.setZeroCopyThreshold(bytes);
+}
+
+void TcpConnection::setCorking(bool on)
+{
+  loop_->assertInLoopThread();
+  corking_ = on;
+}
+
 void TcpConnection::startRead()
 {
   loop_->runInLoop(std::bind(&TcpConnection::startReadInLoop, this));
@@ -313,44 +585,100 @@ void TcpConnection::connectEstablished()
   loop_->assertInLoopThread();
   assert(state_ == kConnecting);
   setState(kConnected);                   // 表示连接已经建立了。
+  loop_->bufferPool()->acquire(&inputBuffer_, Buffer::kInitialSize);
   // shared_from_this
   channel_->tie(shared_from_this());
   channel_->enableReading();          // 并且开始了对该连接的监听。
+  loop_->addEstablished(this);
   connectionCallback_(shared_from_this());  // 连接之后的回调函数。
 }
 
 void TcpConnection::connectDestroyed()
 {
   loop_->assertInLoopThread();
-  if (state_ == kConnected)
+  // kDisconnecting if shutdown() was called but no FIN came back yet
+  if (state_ == kConnected || state_ == kDisconnecting)
   {
     setState(kDisconnected);
     channel_->disableAll();
     connectionCallback_(shared_from_this());  // 重复使用的回调函数。
   }
   channel_->remove();                                 // 移除通道，但是不能立即移除。
+  loop_->removeEstablished(this);
+  // give storage back to pool, no one reads or writes them any more.
+  outputBuffer_.retrieveAll();
+  inputBuffer_.retrieveAll();
+  loop_->bufferPool()->release(&inputBuffer_);
 }
 
 void TcpConnection::handleRead(Timestamp receiveTime)
 {
   loop_->assertInLoopThread();
-  int savedErrno = 0;
-  // 通过buffer的readfd来读取数据。
-  ssize_t n = inputBuffer_.readFd(channel_->fd(), &savedErrno);
-  if (n > 0){
-    // 读取到数据之后，进行消息的回调。
-    messageCallback_(shared_from_this(), &inputBuffer_, receiveTime);
-  }
-  else if (n == 0)
+  // edge-triggered socket won't be reported again until it is drained,
+  // a short read isn't enough, FIN may have arrived along with data.
+  const bool drain = channel_->isEdgeTriggered();
+  do
   {
-    handleClose();
-  }
-  else
-  {
-    errno = savedErrno;
-    LOG_SYSERR << "TcpConnection::handleRead";
-    handleError();
-  }
+    int savedErrno = 0;
+    if (inputBuffer_.readableBytes() == 0 && inputBuffer_.writableBytes() == 0)
+    {
+      // storage was released while idle
+      loop_->bufferPool()->acquire(&inputBuffer_, Buffer::kInitialSize);
+    }
+    ssize_t n = 0;
+    if (channel_->hasFixedRead())
+    {
+      // poller has read it into its buffer, one submission, no drain
+      n = channel_->fixedReadResult();
+      if (n > 0)
+      {
+        inputBuffer_.append(channel_->fixedReadData(), n);
+      }
+      else if (n < 0)
+      {
+        savedErrno = static_cast<int>(-n);
+        n = -1;
+      }
+    }
+    else
+    {
+      // 通过buffer的readfd来读取数据。
+      n = inputBuffer_.readFd(channel_->fd(), &savedErrno);
+    }
+    ++readCalls_;
+    if (n > 0){
+      bytesReceived_ += n;
+      lastReceiveTime_ = receiveTime;
+      // 读取到数据之后，进行消息的回调。
+      messageCallback_(shared_from_this(), &inputBuffer_, receiveTime);
+      lastReadIteration_ = loop_->workIteration();
+      if (idleBufferIterations_ > 0 && !idleCheckPending_
+          && inputBuffer_.readableBytes() == 0)
+      {
+        // iteration() runs ahead of workIteration(), checked again if early
+        idleCheckPending_ = true;
+        loop_->runAfterIteration(
+            loop_->iteration() + idleBufferIterations_,
+            makeWeakCallback(shared_from_this(), &TcpConnection::checkIdleBuffer));
+      }
+    }
+    else if (n == 0)
+    {
+      handleClose();
+      break;
+    }
+    else
+    {
+      if (drain && savedErrno == EWOULDBLOCK)
+      {
+        break;
+      }
+      errno = savedErrno;
+      LOG_SYSERR << "TcpConnection::handleRead";
+      handleError();
+      break;
+    }
+  } while (drain && channel_->isReading());  // stopRead() in callback
 }
 
 void TcpConnection::handleWrite()
@@ -358,13 +686,36 @@ void TcpConnection::handleWrite()
   loop_->assertInLoopThread();
   if (channel_->isWriting())
   {
-    ssize_t n = sockets::write(channel_->fd(),
-                               outputBuffer_.peek(),
-                               outputBuffer_.readableBytes());
+    int savedErrno = 0;
+    ssize_t n = 0;
+    if (channel_->hasFixedWrite())
+    {
+      // poller wrote a copy of head of output
+      n = channel_->fixedWriteResult();
+      if (n > 0)
+      {
+        outputBuffer_.retrieve(n);
+      }
+      else if (n < 0)
+      {
+        savedErrno = static_cast<int>(-n);
+        n = -1;
+      }
+    }
+    else
+    {
+      n = outputBuffer_.writeFd(channel_->fd(), &savedErrno);
+    }
+    countWrite(n);
+    // edge-triggered socket won't be reported writable again until EAGAIN
+    while (n > 0 && channel_->isEdgeTriggered() && !outputBuffer_.empty())
+    {
+      n = outputBuffer_.writeFd(channel_->fd(), &savedErrno);
+      countWrite(n);
+    }
     if (n > 0)
     {
-      outputBuffer_.retrieve(n);
-      if (outputBuffer_.readableBytes() == 0)
+      if (outputBuffer_.empty())
       {
         channel_->disableWriting();
         if (writeCompleteCallback_)
@@ -377,9 +728,20 @@ void TcpConnection::handleWrite()
         }
       }
     }
+    else if (n < 0 && savedErrno == EWOULDBLOCK && channel_->isEdgeTriggered())
+    {
+      LOG_TRACE << "Connection fd = " << channel_->fd()
+                << " would block, wait for next edge";
+    }
     else
     {
+      errno = savedErrno;
       LOG_SYSERR << "TcpConnection::handleWrite";
+      if (outputBuffer_.empty())
+      {
+        // e.g. a truncated file region was dropped
+        channel_->disableWriting();
+      }
       // if (state_ == kDisconnecting)
       // {
       //   shutdownInLoop();
@@ -392,6 +754,80 @@ void TcpConnection::handleWrite()
               << " is down, no more writing";
   }
 }
+void TcpConnection::checkIdleBuffer()
+{
+  loop_->assertInLoopThread();
+  idleCheckPending_ = false;
+  if (state_ == kDisconnected || idleBufferIterations_ <= 0
+      || inputBuffer_.readableBytes() > 0 || inputBuffer_.writableBytes() == 0)
+  {
+    return;
+  }
+  const int64_t due = lastReadIteration_ + idleBufferIterations_;
+  const int64_t now = loop_->workIteration();
+  if (now >= due)
+  {
+    LOG_TRACE << name_ << " releases idle input buffer of "
+              << inputBuffer_.internalCapacity() << " bytes";
+    loop_->bufferPool()->release(&inputBuffer_);
+  }
+  else
+  {
+    // read again since scheduled, check later
+    idleCheckPending_ = true;
+    loop_->runAfterIteration(
+        loop_->iteration() + (due - now),
+        makeWeakCallback(shared_from_this(), &TcpConnection::checkIdleBuffer));
+  }
+}
+
+// 本轮攒下的数据一次写出。
+void TcpConnection::flushCorked()
+{
+  loop_->assertInLoopThread();
+  corkPending_ = false;
+  const int staged = corkedSends_;
+  corkedSends_ = 0;
+  if (state_ == kDisconnected || channel_->isWriting() || outputBuffer_.empty())
+  {
+    return;
+  }
+  int savedErrno = 0;
+  ssize_t n = outputBuffer_.writeFd(channel_->fd(), &savedErrno);
+  countWrite(n);
+  // writeFd() may stop short of EAGAIN, see handleWrite()
+  while (n > 0 && channel_->isEdgeTriggered() && !outputBuffer_.empty())
+  {
+    n = outputBuffer_.writeFd(channel_->fd(), &savedErrno);
+    countWrite(n);
+  }
+  writesSaved_ += staged - 1;
+  if (n < 0 && savedErrno != EWOULDBLOCK)
+  {
+    errno = savedErrno;
+    LOG_SYSERR << "TcpConnection::flushCorked";
+    if (errno == EPIPE || errno == ECONNRESET)
+    {
+      return;
+    }
+  }
+  if (!outputBuffer_.empty())
+  {
+    channel_->enableWriting();
+    return;
+  }
+  if (writeCompleteCallback_)
+  {
+    // it may send more, let that go to next iteration, which we wake up
+    loop_->queueInLoop(std::bind(writeCompleteCallback_, shared_from_this()));
+    loop_->wakeup();
+  }
+  if (state_ == kDisconnecting)
+  {
+    shutdownInLoop();
+  }
+}
+
 // 连接断开的处理方式。
 void TcpConnection::handleClose()
 {
@@ -404,13 +840,23 @@ void TcpConnection::handleClose()
 
   TcpConnectionPtr guardThis(shared_from_this());
   connectionCallback_(guardThis);
-  // must be the last line
-  closeCallback_(guardThis);  // 就是处理Tcpserver注册的回调函数，基本这个函数执行完，其conn对象也就销毁了。
+  // must be the last line, empty once TcpServer tore it down
+  if (closeCallback_)
+  {
+    closeCallback_(guardThis);
+  }  // 就是处理Tcpserver注册的回调函数，基本这个函数执行完，其conn对象也就销毁了。
 }
 
 void TcpConnection::handleError()
 {
+  // MSG_ZEROCOPY completions also make the socket report POLLERR
+  const bool completed = outputBuffer_.zeroCopyInflight() > 0
+      && outputBuffer_.releaseZeroCopied(channel_->fd()) > 0;
   int err = sockets::getSocketError(channel_->fd());
+  if (completed && err == 0)
+  {
+    return;
+  }
   LOG_ERROR << "TcpConnection::handleError [" << name_
             << "] - SO_ERROR = " << err << " " << strerror_tl(err);
 }
@@ -16,14 +16,17 @@
 #include "muduo/base/Types.h"
 #include "muduo/net/Callbacks.h"
 #include "muduo/net/Buffer.h"
+#include "muduo/net/BufferChain.h"
 #include "muduo/net/InetAddress.h"
 
 #include <memory>
+#include <vector>
 
 #include <boost/any.hpp>
 
 // struct tcp_info is in <netinet/tcp.h>
 struct tcp_info;
+struct iovec;
 
 namespace muduo
 {
@@ -62,11 +65,37 @@ class TcpConnection : noncopyable,
   bool getTcpInfo(struct tcp_info*) const;
   string getTcpInfoString() const;
 
-  // void send(string&& message); // C++11
+  // counters, updated in the loop thread, read them there too
+  Timestamp creationTime() const { return creationTime_; }
+  Timestamp lastReceiveTime() const { return lastReceiveTime_; }
+  int64_t bytesReceived() const { return bytesReceived_; }
+  int64_t bytesSent() const { return bytesSent_; }
+  int64_t readCalls() const { return readCalls_; }
+  int64_t writeCalls() const { return writeCalls_; }
+  /// Max bytes ever queued in output buffer.
+  size_t outputHighWaterMark() const { return outputHighWaterMark_; }
+  /// write(2) calls avoided by corking, see setCorking().
+  int64_t writesSaved() const { return writesSaved_; }
+
   void send(const void* message, int len);
   void send(const StringPiece& message);
-  // void send(Buffer&& message); // C++11
+  void send(const char* message)  // not ambiguous between string&& and StringPiece
+  { send(StringPiece(message)); }
+  /// Moves @c message to the loop thread instead of copying it,
+  /// only what can't be written right away is copied to output buffer.
+  /// @c message is left empty.
+  void send(string&& message);
+  /// Links storage of @c message into output buffer, never copies the data.
+  /// @c message is left empty.
+  void send(Buffer&& message);
   void send(Buffer* message);  // this one will swap data
+  /// Gathers @c pieces with one writev(2) if called in the loop thread,
+  /// otherwise copies them once into a single chunk.
+  void send(const std::vector<StringPiece>& pieces);
+  /// Sends @c length bytes of file @c fd starting at @c offset, with sendfile(2).
+  /// The file region is queued after data sent before, the fd is dup(2)ed,
+  /// so caller may close it once this function returns.
+  void sendFile(int fd, int64_t offset, size_t length);
   // shutdown不是线程安全的。
   void shutdown(); // NOT thread safe, no simultaneous calling
   // void shutdownAndForceCloseAfter(double seconds); // NOT thread safe, no simultaneous calling
@@ -77,6 +106,27 @@ class TcpConnection : noncopyable,
   void startRead();
   void stopRead();
   bool isReading() const { return reading_; }; // NOT thread safe, may race with start/stopReadInLoop
+  /// Registers the socket edge-triggered, reads and writes drain it until
+  /// EAGAIN, and write interest never needs epoll_ctl(MOD).
+  /// Must be called before connectEstablished(), falls back to
+  /// level-triggered if the poller doesn't support it.
+  void setEdgeTriggered(bool on);
+  bool isEdgeTriggered() const;
+  /// Sends chunks of at least @c bytes with MSG_ZEROCOPY, 0 to disable.
+  /// Only payloads handed over as a Buffer qualify, i.e. send(Buffer&&),
+  /// or send(Buffer*) from other threads, other send()s copy anyway.
+  /// The chunk is released when the kernel reports completion on the
+  /// socket's error queue. Worth it for payloads over ~10KiB.
+  /// Must be called in the loop thread.
+  void setZeroCopyThreshold(size_t bytes);
+  /// Stages every send() of a loop iteration in output buffer, and writes
+  /// them with one writev(2) once the loop has dispatched active channels
+  /// and pending functors, e.g. a header and a body, or several replies
+  /// to pipelined requests. Data sent outside of loop() waits for the end
+  /// of the next iteration.
+  /// Must be called in the loop thread.
+  void setCorking(bool on);
+  bool isCorking() const { return corking_; }
 
   void setContext(const boost::any& context)
   { context_ = context; }
@@ -99,11 +149,19 @@ class TcpConnection : noncopyable,
   void setHighWaterMarkCallback(const HighWaterMarkCallback& cb, size_t highWaterMark)
   { highWaterMarkCallback_ = cb; highWaterMark_ = highWaterMark; }
 
+  /// Returns storage of input buffer to the loop's BufferPool once it has
+  /// been empty for @c iterations loop iterations, 0 to disable (default).
+  /// Empty spins of EventLoop::setBusyPoll() don't count.
+  /// Output chunks always go back to the pool as soon as they are written.
+  /// Must be called in the loop thread.
+  void setIdleBufferRelease(int iterations)
+  { idleBufferIterations_ = iterations; }
+
   /// Advanced interface
   Buffer* inputBuffer()
   { return &inputBuffer_; }
 
-  Buffer* outputBuffer()
+  BufferChain* outputBuffer()
   { return &outputBuffer_; }
 
   /// Internal use only.
@@ -121,9 +179,14 @@ class TcpConnection : noncopyable,
   void handleWrite();
   void handleClose();
   void handleError();
-  // void sendInLoop(string&& message);
   void sendInLoop(const StringPiece& message);
   void sendInLoop(const void* message, size_t len);
+  void sendInLoop(const std::vector<StringPiece>& pieces);
+  void sendChunkInLoop(const BufferPtr& chunk);
+  bool writeDirectly(const struct iovec* vec, int count, size_t len, size_t* nwrote);
+  void outputAppended(size_t oldLen);
+  void writeAppended(size_t oldLen);
+  void sendFileInLoop(const FileRegionPtr& file);
   void shutdownInLoop();
   // void shutdownAndForceCloseInLoop(double seconds);
   void forceCloseInLoop();
@@ -131,6 +194,13 @@ class TcpConnection : noncopyable,
   const char* stateToString() const;
   void startReadInLoop();
   void stopReadInLoop();
+  void checkIdleBuffer();
+  void flushCorked();
+  void countWrite(ssize_t n)
+  {
+    ++writeCalls_;
+    if (n > 0) bytesSent_ += n;
+  }
 
   EventLoop* loop_;     // 所有Eventloop
   const string name_;
@@ -148,13 +218,25 @@ class TcpConnection : noncopyable,
   HighWaterMarkCallback highWaterMarkCallback_;
   CloseCallback closeCallback_;                // 关闭连接。
   size_t highWaterMark_;
+  int idleBufferIterations_;
+  bool idleCheckPending_;
+  int64_t lastReadIteration_;
+  bool corking_;
+  bool corkPending_;      // flushCorked() scheduled
+  int corkedSends_;       // sends staged since last flush
   // 应用层接收缓冲区。
   Buffer inputBuffer_;
-  // 应用层发送缓冲区。
-  Buffer outputBuffer_; // FIXME: use list<Buffer> as output buffer.
+  // 应用层发送缓冲区，由多个Buffer块串成，用writev一次写出。
+  BufferChain outputBuffer_;
   boost::any context_;
-  // FIXME: creationTime_, lastReceiveTime_
-  //        bytesReceived_, bytesSent_
+  const Timestamp creationTime_;
+  Timestamp lastReceiveTime_;
+  int64_t bytesReceived_;
+  int64_t bytesSent_;
+  int64_t readCalls_;     // read(2)/readv(2) calls
+  int64_t writeCalls_;    // write(2)/writev(2)/sendfile(2) calls
+  size_t outputHighWaterMark_;
+  int64_t writesSaved_;
 };
 
 typedef std::shared_ptr<TcpConnection> TcpConnectionPtr;
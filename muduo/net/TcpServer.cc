@@ -8,6 +8,7 @@
 
 #include "muduo/net/TcpServer.h"
 
+#include "muduo/base/CountDownLatch.h"
 #include "muduo/base/Logging.h"
 #include "muduo/net/Acceptor.h"
 #include "muduo/net/EventLoop.h"
@@ -19,22 +20,46 @@
 using namespace muduo;
 using namespace muduo::net;
 
+namespace
+{
+void destroyAcceptor(Acceptor* acceptor, CountDownLatch* latch)
+{
+  delete acceptor;
+  latch->countDown();
+}
+
+// in loop of conn, after that it never calls back into TcpServer
+void destroyConnection(const TcpConnectionPtr& conn, CountDownLatch* latch)
+{
+  conn->setCloseCallback(CloseCallback());
+  conn->connectDestroyed();
+  latch->countDown();
+}
+}  // namespace
+
 TcpServer::TcpServer(EventLoop* loop,
                      const InetAddress& listenAddr,
                      const string& nameArg,
                      Option option)
   : loop_(CHECK_NOTNULL(loop)),  // 检查loop不是一个空指针。
+    listenAddr_(listenAddr),
     ipPort_(listenAddr.toIpPort()),      // 端口号。
     name_(nameArg),
-    acceptor_(new Acceptor(loop, listenAddr, option == kReusePort)),  // 开始建立监听的套接字。
+    acceptorPerLoop_(option == kReusePortPerLoop),
+    acceptor_(acceptorPerLoop_ ? NULL
+              : new Acceptor(loop, listenAddr, option == kReusePort)),  // 开始建立监听的套接字。
     threadPool_(new EventLoopThreadPool(loop, name_)),  // 还是主的eventloop。
     connectionCallback_(defaultConnectionCallback),         // 用户的回调函数。
     messageCallback_(defaultMessageCallback),
+    edgeTriggered_(false),
     nextConnId_(1)
 {
   // 设置回调函数。_1对应的是scoket文件描述符，_2对应的是对等方的地址（InetAddress）。
-  acceptor_->setNewConnectionCallback(
-      std::bind(&TcpServer::newConnection, this, _1, _2));
+  if (acceptor_)
+  {
+    acceptor_->setNewConnectionCallback(
+        std::bind(&TcpServer::newConnection, this, _1, _2));
+  }
 }
 
 TcpServer::~TcpServer()
@@ -42,7 +67,39 @@ TcpServer::~TcpServer()
   loop_->assertInLoopThread();
   LOG_TRACE << "TcpServer::~TcpServer [" << name_ << "] destructing";
 
-  for (auto& item : connections_)
+  // stop accepting in every IO loop before connections are torn down
+  if (!loopAcceptors_.empty())
+  {
+    CountDownLatch latch(static_cast<int>(loopAcceptors_.size()));
+    for (auto& item : loopAcceptors_)
+    {
+      item.first->runInLoop(
+          std::bind(destroyAcceptor, item.second.release(), &latch));
+    }
+    latch.wait();
+  }
+
+  ConnectionMap connections;
+  {
+    MutexLockGuard lock(mutex_);
+    connections.swap(connections_);
+  }
+  if (acceptorPerLoop_)
+  {
+    // connections remove themselves in their own loops, without a hop to
+    // loop_, so tear them down there and wait, a close racing with us
+    // finds its entry gone and leaves it to destroyConnection.
+    CountDownLatch latch(static_cast<int>(connections.size()));
+    for (auto& item : connections)
+    {
+      TcpConnectionPtr conn(item.second);
+      item.second.reset();
+      conn->getLoop()->runInLoop(std::bind(destroyConnection, conn, &latch));
+    }
+    latch.wait();
+    return;
+  }
+  for (auto& item : connections)
   {
     TcpConnectionPtr conn(item.second);
     item.second.reset();
@@ -60,6 +117,18 @@ void TcpServer::setThreadNum(int numThreads)
 void TcpServer::start(){
   if (started_.getAndSet(1) == 0){    // 如果没有启动则执行下面的操作。
     threadPool_->start(threadInitCallback_);  // 这里就相当于是启动了这么多个ThreadEventLoop。
+    if (acceptorPerLoop_)
+    {
+      for (EventLoop* ioLoop : threadPool_->getAllLoops())
+      {
+        std::unique_ptr<Acceptor> acceptor(new Acceptor(ioLoop, listenAddr_, true));
+        acceptor->setNewConnectionCallback(
+            std::bind(&TcpServer::newConnectionInLoop, this, ioLoop, _1, _2));
+        ioLoop->runInLoop(std::bind(&Acceptor::listen, get_pointer(acceptor)));
+        loopAcceptors_.push_back(std::make_pair(ioLoop, std::move(acceptor)));
+      }
+      return;
+    }
     assert(!acceptor_->listening());  // 如果没有处于监听的状态。
     loop_->runInLoop(
         std::bind(&Acceptor::listen, get_pointer(acceptor_)));  // 返回它的原生指针。
@@ -69,9 +138,25 @@ void TcpServer::start(){
 void TcpServer::newConnection(int sockfd, const InetAddress& peerAddr){
   loop_->assertInLoopThread();
   EventLoop* ioLoop = threadPool_->getNextLoop();         // 选择一个loop来处理该TCP连接。
+  TcpConnectionPtr conn(createConnection(ioLoop, sockfd, peerAddr));
+  ioLoop->runInLoop(std::bind(&TcpConnection::connectEstablished, conn));   // 这里就表示连接已经建立了。
+}
+
+void TcpServer::newConnectionInLoop(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr)
+{
+  ioLoop->assertInLoopThread();
+  // accepted by the listening socket of this loop, no hop to base loop
+  createConnection(ioLoop, sockfd, peerAddr)->connectEstablished();
+}
+
+TcpConnectionPtr TcpServer::createConnection(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr)
+{
   char buf[64];
-  snprintf(buf, sizeof buf, "-%s#%d", ipPort_.c_str(), nextConnId_);
-  ++nextConnId_;
+  {
+    MutexLockGuard lock(mutex_);
+    snprintf(buf, sizeof buf, "-%s#%d", ipPort_.c_str(), nextConnId_);
+    ++nextConnId_;
+  }
   string connName = name_ + buf;
 
   LOG_INFO << "TcpServer::newConnection [" << name_
@@ -85,29 +170,48 @@ void TcpServer::newConnection(int sockfd, const InetAddress& peerAddr){
                                           sockfd,
                                           localAddr,
                                           peerAddr));
-  connections_[connName] = conn;  // 通过map管理所有的TCP连接。
+  {
+    MutexLockGuard lock(mutex_);
+    connections_[connName] = conn;  // 通过map管理所有的TCP连接。
+  }
   // 设置connection的回调函数。
   conn->setConnectionCallback(connectionCallback_);
   conn->setMessageCallback(messageCallback_);
   conn->setWriteCompleteCallback(writeCompleteCallback_);
+  conn->setEdgeTriggered(edgeTriggered_);
   // 关闭连接的处理方式，因为肯定是调用连接的关闭函数。
   conn->setCloseCallback(
       std::bind(&TcpServer::removeConnection, this, _1)); // FIXME: unsafe
-  ioLoop->runInLoop(std::bind(&TcpConnection::connectEstablished, conn));   // 这里就表示连接已经建立了。
+  return conn;
 }
 
 void TcpServer::removeConnection(const TcpConnectionPtr& conn){
+  if (acceptorPerLoop_)
+  {
+    // stays in the loop of conn, as it was created
+    removeConnectionInLoop(conn);
+    return;
+  }
   // FIXME: unsafe
   loop_->runInLoop(std::bind(&TcpServer::removeConnectionInLoop, this, conn));
 }
 
 void TcpServer::removeConnectionInLoop(const TcpConnectionPtr& conn)
 { // 发生移除关系。
-  loop_->assertInLoopThread();
+  assert(acceptorPerLoop_ || loop_->isInLoopThread());
   LOG_INFO << "TcpServer::removeConnectionInLoop [" << name_
            << "] - connection " << conn->name();
-  size_t n = connections_.erase(conn->name());                  // 抹除在connections中的channel。
-  (void)n;
+  size_t n = 0;
+  {
+    MutexLockGuard lock(mutex_);
+    n = connections_.erase(conn->name());                  // 抹除在connections中的channel。
+  }
+  if (n == 0)
+  {
+    // with acceptorPerLoop_, ~TcpServer took it and destroys it in this loop
+    assert(acceptorPerLoop_);
+    return;
+  }
   assert(n == 1);
   EventLoop* ioLoop = conn->getLoop();                          // 获得conn的loop对象。
   ioLoop->queueInLoop(
@@ -12,10 +12,13 @@
 #define MUDUO_NET_TCPSERVER_H
 
 #include "muduo/base/Atomic.h"
+#include "muduo/base/Mutex.h"
 #include "muduo/base/Types.h"
+#include "muduo/net/InetAddress.h"
 #include "muduo/net/TcpConnection.h"
 
 #include <map>
+#include <vector>
 
 namespace muduo
 {
@@ -38,6 +41,10 @@ class TcpServer : noncopyable
   {
     kNoReusePort,
     kReusePort,
+    // every IO loop listens on its own SO_REUSEPORT socket and accepts
+    // connections for itself, the kernel balances them among loops.
+    // The port of listenAddr must not be 0.
+    kReusePortPerLoop,
   };
 
   //TcpServer(EventLoop* loop, const InetAddress& listenAddr);
@@ -60,11 +67,17 @@ class TcpServer : noncopyable
   ///   this is the default value.
   /// - 1 means all I/O in another thread.
   /// - N means a thread pool with N threads, new connections
-  ///   are assigned on a round-robin basis.
+  ///   are assigned on a round-robin basis, or per
+  ///   threadPool()->setLoadBalance(), or by kernel with kReusePortPerLoop.
   void setThreadNum(int numThreads);
   void setThreadInitCallback(const ThreadInitCallback& cb)
   { threadInitCallback_ = cb; }
-  /// valid after calling start()
+  /// Registers connections edge-triggered, see TcpConnection::setEdgeTriggered().
+  /// Must be called before @c start
+  void setEdgeTriggered(bool on)
+  { edgeTriggered_ = on; }
+
+  /// loops are valid after calling start(), set load balance before it.
   std::shared_ptr<EventLoopThreadPool> threadPool()
   { return threadPool_; }
 
@@ -92,6 +105,10 @@ class TcpServer : noncopyable
  private:
   /// Not thread safe, but in loop
   void newConnection(int sockfd, const InetAddress& peerAddr);
+  /// In ioLoop, for kReusePortPerLoop
+  void newConnectionInLoop(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr);
+  /// Thread safe.
+  TcpConnectionPtr createConnection(EventLoop* ioLoop, int sockfd, const InetAddress& peerAddr);
   /// Thread safe.
   void removeConnection(const TcpConnectionPtr& conn);
   /// Not thread safe, but in loop
@@ -100,18 +117,23 @@ class TcpServer : noncopyable
   typedef std::map<string, TcpConnectionPtr> ConnectionMap; // 连接对象的指针。
 
   EventLoop* loop_;     // the acceptor loop
+  const InetAddress listenAddr_;
   const string ipPort_;  // 监听的端口号。
   const string name_;   // 服务名称。
-  std::unique_ptr<Acceptor> acceptor_; // avoid revealing Acceptor，acceptor
+  const bool acceptorPerLoop_;
+  std::unique_ptr<Acceptor> acceptor_; // avoid revealing Acceptor，acceptor, null if acceptorPerLoop_
+  std::vector<std::pair<EventLoop*, std::unique_ptr<Acceptor>>> loopAcceptors_;  // for acceptorPerLoop_
   std::shared_ptr<EventLoopThreadPool> threadPool_; // IO线程池。
   ConnectionCallback connectionCallback_; // 连接到来的回调函数。
   MessageCallback messageCallback_;       // 消息到来的回调函数。
   WriteCompleteCallback writeCompleteCallback_;
   ThreadInitCallback threadInitCallback_;
   AtomicInt32 started_;                             // 原子性整数。
-  // always in loop thread
-  int nextConnId_; // 下一个连接的id。
-  ConnectionMap connections_;  // 一个连接列表。
+  bool edgeTriggered_;
+  // in IO loops as well with acceptorPerLoop_
+  MutexLock mutex_;
+  int nextConnId_ GUARDED_BY(mutex_); // 下一个连接的id。
+  ConnectionMap connections_ GUARDED_BY(mutex_);  // 一个连接列表。
 };
 
 }  // namespace net
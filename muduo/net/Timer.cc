@@ -8,6 +8,8 @@
 
 #include "muduo/net/Timer.h"
 
+#include <assert.h>
+
 using namespace muduo;
 using namespace muduo::net;
 
@@ -22,3 +24,21 @@ void Timer::restart(Timestamp now)
     expiration_ = Timestamp::invalid();
   }
 }
+
+void Timer::retire()
+{
+  assert(slot_ == -1);
+  TimerCallback().swap(callback_);
+  expiration_ = Timestamp::invalid();
+  sequence_ = 0;
+}
+
+void Timer::reuse(const TimerCallback& cb, Timestamp when, double interval, int64_t sequence)
+{
+  assert(sequence_ == 0 && slot_ == -1);
+  callback_ = cb;
+  expiration_ = when;
+  interval_ = interval;
+  repeat_ = interval > 0.0;
+  sequence_ = sequence;
+}
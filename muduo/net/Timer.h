@@ -32,7 +32,10 @@ class Timer : noncopyable
       expiration_(when),
       interval_(interval),
       repeat_(interval > 0.0),
-      sequence_(s_numCreated_.incrementAndGet())  // 这是一个原子操作，保证sequence_的唯一性。
+      sequence_(s_numCreated_.incrementAndGet()),  // 这是一个原子操作，保证sequence_的唯一性。
+      prev_(NULL),
+      next_(NULL),
+      slot_(-1)
   { }
 
   void run() const{                     // 执行定时器的回调函数。
@@ -46,13 +49,27 @@ class Timer : noncopyable
   void restart(Timestamp now);
 
   static int64_t numCreated() { return s_numCreated_.get(); }
+  static int64_t newSequence() { return s_numCreated_.incrementAndGet(); }
+
+  // With TimingWheel, TimerQueue recycles timers instead of deleting them,
+  // so a stale TimerId still points to a Timer and fails the sequence check.
+  // Drops the callback, no TimerId matches a retired timer.
+  void retire();
+  void reuse(const TimerCallback& cb, Timestamp when, double interval, int64_t sequence);
 
  private:
-  const TimerCallback callback_;    // 定时器回调函数。
+  TimerCallback callback_;    // 定时器回调函数。
   Timestamp expiration_;               // 下一次的超时时刻。
-  const double interval_;                // 超时时间间隔，如果是一次性定时器，该值为0.
-  const bool repeat_;                     // 是否重复。
-  const int64_t sequence_;            // 定时器序号。
+  double interval_;                // 超时时间间隔，如果是一次性定时器，该值为0.
+  bool repeat_;                     // 是否重复。
+  int64_t sequence_;            // 定时器序号。
+
+  // intrusive list links of TimingWheel, so that insert and cancel
+  // need no allocation.
+  friend class TimingWheel;
+  Timer* prev_;
+  Timer* next_;
+  int slot_;                            // -1 if not in a wheel
 
   static AtomicInt64 s_numCreated_;   // 定时器计数，当前已经创建的定时器数量。这是一个原子性的。
 };
@@ -12,6 +12,7 @@
 #define MUDUO_NET_TIMERID_H
 
 #include "muduo/base/copyable.h"
+#include "muduo/base/Types.h"
 
 namespace muduo
 {
@@ -16,7 +16,9 @@
 #include "muduo/net/EventLoop.h"
 #include "muduo/net/Timer.h"
 #include "muduo/net/TimerId.h"
+#include "muduo/net/TimingWheel.h"
 
+#include <stdlib.h>
 #include <sys/timerfd.h>
 #include <unistd.h>
 
@@ -94,6 +96,10 @@ TimerQueue::TimerQueue(EventLoop* loop)
     timerfdChannel_(loop, timerfd_),
     timers_(),
     callingExpiredTimers_(false){
+  if (::getenv("MUDUO_USE_TIMING_WHEEL"))
+  {
+    wheel_.reset(new TimingWheel(Timestamp::now()));
+  }
   // 这里就是对与定时器的回调函数的处理方式。
   // 但是这里如何通过这一个文件描述符去处理所有的定时器函数，这里就让eventloop关注起了定时器事件。
   timerfdChannel_.setReadCallback(
@@ -112,11 +118,37 @@ TimerQueue::~TimerQueue()
   {
     delete timer.second;
   }
+  // timers in wheel_ are deleted by it
+  for (Timer* timer : freeTimers_)
+  {
+    delete timer;
+  }
 }
 
 TimerId TimerQueue::addTimer(TimerCallback cb,
                              Timestamp when,  // 超时时间。
                              double interval){    // 间隔时间。
+  if (wheel_)
+  {
+    Timer* timer = NULL;
+    {
+      MutexLockGuard lock(freeMutex_);
+      if (!freeTimers_.empty())
+      {
+        timer = freeTimers_.back();
+        freeTimers_.pop_back();
+      }
+    }
+    if (timer)
+    {
+      // fields are only written in loop, where cancel() reads them
+      const int64_t sequence = Timer::newSequence();
+      loop_->runInLoop(
+          std::bind(&TimerQueue::reuseTimerInLoop, this, timer, std::move(cb),
+                    when, interval, sequence));
+      return TimerId(timer, sequence);
+    }
+  }
   Timer* timer = new Timer(std::move(cb), when, interval);  // 构造了一个时间的对象。
   // 这里只是借助eventloop的IO线程进行添加定时器，并没有对定时器本身做什么？
   loop_->runInLoop(
@@ -135,7 +167,7 @@ void TimerQueue::addTimerInLoop(Timer* timer){
   // 这里也就点破了为什么用一个timefd就能够负责这么多个定时器的缘故。
   bool earliestChanged = insert(timer); // 执行插入操作。 如果插入的倒计时时间更早，那么这里就会为ture。
   if (earliestChanged){                       // 为什么要在当前线程？因为为了防止，多个线程改变了最早的定时器。
-    resetTimerfd(timerfd_, timer->expiration());// timerfd_也就是定时器文件描述符。
+    resetTimerfd(timerfd_, nextExpiration());// timerfd_也就是定时器文件描述符。
   }
 }
 // 取消定时器。
@@ -144,6 +176,18 @@ void TimerQueue::cancelInLoop(TimerId timerId)
   loop_->assertInLoopThread();
   assert(timers_.size() == activeTimers_.size());
   ActiveTimer timer(timerId.timer_, timerId.sequence_);
+  if (wheel_)
+  {
+    if (wheel_->remove(timerId.timer_, timerId.sequence_))
+    {
+      releaseTimer(timerId.timer_);
+    }
+    else if (callingExpiredTimers_)
+    {
+      cancelingTimers_.insert(timer);
+    }
+    return;
+  }
   ActiveTimerSet::iterator it = activeTimers_.find(timer);
   if (it != activeTimers_.end())
   {
@@ -180,6 +224,17 @@ std::vector<TimerQueue::Entry> TimerQueue::getExpired(Timestamp now)
 {
   assert(timers_.size() == activeTimers_.size());
   std::vector<Entry> expired;
+  if (wheel_)
+  {
+    std::vector<Timer*> timers;
+    wheel_->advance(now, &timers);
+    expired.reserve(timers.size());
+    for (Timer* timer : timers)
+    {
+      expired.push_back(Entry(timer->expiration(), timer));
+    }
+    return expired;
+  }
   Entry sentry(now, reinterpret_cast<Timer*>(UINTPTR_MAX));
   // 返回第一个未到期的timer的迭代器。
   TimerList::iterator end = timers_.lower_bound(sentry);
@@ -213,27 +268,50 @@ void TimerQueue::reset(const std::vector<Entry>& expired, Timestamp now)
       it.second->restart(now);
       insert(it.second);
     }else{
-      // FIXME move to a free list
       // 一次性定时器不能重置，因此删除该定时器。
-      delete it.second; // FIXME: no delete please
+      releaseTimer(it.second);
     }
   }
 
-  if (!timers_.empty())
+  nextExpire = nextExpiration();
+  if (nextExpire.valid())
   {
-    nextExpire = timers_.begin()->second->expiration();
+    resetTimerfd(timerfd_, nextExpire);
   }
+}
+void TimerQueue::reuseTimerInLoop(Timer* timer, const TimerCallback& cb,
+                                  Timestamp when, double interval, int64_t sequence)
+{
+  timer->reuse(cb, when, interval, sequence);
+  addTimerInLoop(timer);
+}
 
-  if (nextExpire.valid())
+void TimerQueue::releaseTimer(Timer* timer)
+{
+  loop_->assertInLoopThread();
+  if (wheel_)
   {
-    resetTimerfd(timerfd_, nextExpire);
+    timer->retire();
+    MutexLockGuard lock(freeMutex_);
+    freeTimers_.push_back(timer);
+  }
+  else
+  {
+    delete timer; // FIXME: no delete please
   }
 }
+
 // 插入一个timer，判断是否改变了最早的定时器。
 bool TimerQueue::insert(Timer* timer)
 {
   loop_->assertInLoopThread();
   assert(timers_.size() == activeTimers_.size());
+  if (wheel_)
+  {
+    Timestamp earliest = wheel_->nextEventTime();
+    wheel_->insert(timer);
+    return !earliest.valid() || wheel_->nextEventTime() < earliest;
+  }
   // 最早到期时间是否改变。
   bool earliestChanged = false;
   Timestamp when = timer->expiration();
@@ -258,3 +336,12 @@ bool TimerQueue::insert(Timer* timer)
   return earliestChanged;
 }
 
+
+Timestamp TimerQueue::nextExpiration() const
+{
+  if (wheel_)
+  {
+    return wheel_->nextEventTime();
+  }
+  return timers_.empty() ? Timestamp::invalid() : timers_.begin()->first;
+}
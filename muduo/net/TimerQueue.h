@@ -11,6 +11,7 @@
 #ifndef MUDUO_NET_TIMERQUEUE_H
 #define MUDUO_NET_TIMERQUEUE_H
 
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -27,12 +28,17 @@ namespace net
 class EventLoop;
 class Timer;
 class TimerId;
+class TimingWheel;
 
 ///
 /// A best efforts timer queue.
 /// No guarantee that the callback will be on time.
 // 定时器的队列，里面维护了一个列表。
 ///
+/// Timers are kept in sets by default, with MUDUO_USE_TIMING_WHEEL in
+/// environment a TimingWheel of 1ms resolution is used instead, which
+/// has O(1) insert and cancel for massive timer counts.
+///
 class TimerQueue : noncopyable
 {
  public:
@@ -75,6 +81,12 @@ class TimerQueue : noncopyable
   void reset(const std::vector<Entry>& expired, Timestamp now);
 
   bool insert(Timer* timer);
+  Timestamp nextExpiration() const;
+  // with wheel_, timers are recycled, so cancel() of a stale TimerId
+  // never touches freed memory.
+  void reuseTimerInLoop(Timer* timer, const TimerCallback& cb,
+                        Timestamp when, double interval, int64_t sequence);
+  void releaseTimer(Timer* timer);
 
   EventLoop* loop_;     // 所属EventLoop
   // 是通过这一个timerfd来监控所有的定时器吗？如何监控？
@@ -88,6 +100,10 @@ class TimerQueue : noncopyable
   ActiveTimerSet activeTimers_;                   // 是按对象地址排序的。
   bool callingExpiredTimers_; /* atomic */    // 是否处于调用超时的定时器。
   ActiveTimerSet cancelingTimers_;             // 保存的是被取消的定时器。
+  // replaces timers_ and activeTimers_ if not null
+  std::unique_ptr<TimingWheel> wheel_;
+  MutexLock freeMutex_;
+  std::vector<Timer*> freeTimers_ GUARDED_BY(freeMutex_);  // retired, for wheel_
 };
 
 }  // namespace net
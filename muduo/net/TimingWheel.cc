@@ -0,0 +1,223 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/TimingWheel.h"
+
+#include "muduo/net/Timer.h"
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <algorithm>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const int64_t TimingWheel::kTickMicroSeconds;
+const int TimingWheel::kSlotBits;
+const int TimingWheel::kSlots;
+const int TimingWheel::kLevels;
+
+namespace
+{
+
+const int64_t kMaxDelta = (int64_t(1) << (TimingWheel::kSlotBits * TimingWheel::kLevels)) - 1;
+
+// first tick not earlier than the expiration, so timers never fire early
+int64_t tickOf(const Timer* timer)
+{
+  const int64_t us = timer->expiration().microSecondsSinceEpoch();
+  return (us + TimingWheel::kTickMicroSeconds - 1) / TimingWheel::kTickMicroSeconds;
+}
+
+uint64_t rotateRight(uint64_t bits, int n)
+{
+  return n == 0 ? bits : (bits >> n) | (bits << (64 - n));
+}
+
+bool earlier(const Timer* lhs, const Timer* rhs)
+{
+  return lhs->expiration() < rhs->expiration()
+      || (lhs->expiration() == rhs->expiration() && lhs->sequence() < rhs->sequence());
+}
+
+}  // namespace
+
+TimingWheel::TimingWheel(Timestamp now)
+  : currentTick_(now.microSecondsSinceEpoch() / kTickMicroSeconds),
+    size_(0)
+{
+  static_assert(kSlots == 64, "occupied_ is a 64-bit bitmap");
+  memZero(slots_, sizeof slots_);
+  memZero(occupied_, sizeof occupied_);
+}
+
+TimingWheel::~TimingWheel()
+{
+  for (int level = 0; level < kLevels; ++level)
+  {
+    for (int slot = 0; slot < kSlots; ++slot)
+    {
+      while (Timer* timer = slots_[level][slot])
+      {
+        unlink(timer);
+        delete timer;
+      }
+    }
+  }
+}
+
+void TimingWheel::insert(Timer* timer)
+{
+  assert(timer->slot_ == -1);
+  ++size_;
+  // the slot of currentTick_ has been processed
+  place(timer, std::max(tickOf(timer), currentTick_ + 1));
+}
+
+bool TimingWheel::remove(Timer* timer, int64_t sequence)
+{
+  // a recycled timer carries a newer sequence
+  if (timer == NULL || timer->slot_ == -1 || timer->sequence() != sequence)
+  {
+    return false;
+  }
+  unlink(timer);
+  --size_;
+  return true;
+}
+
+void TimingWheel::place(Timer* timer, int64_t tick)
+{
+  assert(tick >= currentTick_);
+  int64_t delta = tick - currentTick_;
+  if (delta > kMaxDelta)
+  {
+    // parked in last level, re-placed when cascaded
+    delta = kMaxDelta;
+    tick = currentTick_ + delta;
+  }
+  int level = 0;
+  while (delta >> (kSlotBits * (level + 1)))
+  {
+    ++level;
+  }
+  const int slot = static_cast<int>((tick >> (kSlotBits * level)) & (kSlots - 1));
+
+  Timer*& head = slots_[level][slot];
+  timer->prev_ = NULL;
+  timer->next_ = head;
+  if (head)
+  {
+    head->prev_ = timer;
+  }
+  head = timer;
+  timer->slot_ = level * kSlots + slot;
+  occupied_[level] |= uint64_t(1) << slot;
+}
+
+void TimingWheel::unlink(Timer* timer)
+{
+  assert(timer->slot_ >= 0);
+  const int level = timer->slot_ / kSlots;
+  const int slot = timer->slot_ % kSlots;
+  if (timer->prev_)
+  {
+    timer->prev_->next_ = timer->next_;
+  }
+  else
+  {
+    assert(slots_[level][slot] == timer);
+    slots_[level][slot] = timer->next_;
+    if (timer->next_ == NULL)
+    {
+      occupied_[level] &= ~(uint64_t(1) << slot);
+    }
+  }
+  if (timer->next_)
+  {
+    timer->next_->prev_ = timer->prev_;
+  }
+  timer->prev_ = timer->next_ = NULL;
+  timer->slot_ = -1;
+}
+
+void TimingWheel::cascade(int level, int slot)
+{
+  while (Timer* timer = slots_[level][slot])
+  {
+    unlink(timer);
+    place(timer, std::max(tickOf(timer), currentTick_));
+  }
+}
+
+int64_t TimingWheel::nextEventTick() const
+{
+  int64_t next = INT64_MAX;
+  for (int level = 0; level < kLevels; ++level)
+  {
+    const int shift = kSlotBits * level;
+    const int64_t block = currentTick_ >> shift;
+    if (((block + 1) << shift) >= next)
+    {
+      break;  // higher levels can only be later
+    }
+    if (occupied_[level])
+    {
+      // the slot of current block is empty, search from the next one
+      const int start = static_cast<int>((block + 1) & (kSlots - 1));
+      const int k = __builtin_ctzll(rotateRight(occupied_[level], start));
+      next = std::min(next, (block + 1 + k) << shift);
+    }
+  }
+  return next;
+}
+
+Timestamp TimingWheel::nextEventTime() const
+{
+  if (size_ == 0)
+  {
+    return Timestamp::invalid();
+  }
+  return Timestamp(nextEventTick() * kTickMicroSeconds);
+}
+
+void TimingWheel::advance(Timestamp now, std::vector<Timer*>* expired)
+{
+  const int64_t nowTick = now.microSecondsSinceEpoch() / kTickMicroSeconds;
+  // jumps over empty ticks, each round is a cascade and/or an expiration
+  while (size_ > 0)
+  {
+    const int64_t tick = nextEventTick();
+    if (tick > nowTick)
+    {
+      break;
+    }
+    currentTick_ = tick;
+    for (int level = kLevels - 1; level > 0; --level)
+    {
+      const int shift = kSlotBits * level;
+      if ((tick & ((int64_t(1) << shift) - 1)) == 0)
+      {
+        cascade(level, static_cast<int>((tick >> shift) & (kSlots - 1)));
+      }
+    }
+
+    const size_t first = expired->size();
+    Timer*& head = slots_[0][tick & (kSlots - 1)];
+    while (Timer* timer = head)
+    {
+      unlink(timer);
+      --size_;
+      expired->push_back(timer);
+    }
+    // a tick is 1ms, keep finer order like the set-based queue
+    std::sort(expired->begin() + first, expired->end(), earlier);
+  }
+  currentTick_ = std::max(currentTick_, nowTick);
+}
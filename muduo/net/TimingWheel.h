@@ -0,0 +1,79 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is an internal header file, you should not include this.
+
+#ifndef MUDUO_NET_TIMINGWHEEL_H
+#define MUDUO_NET_TIMINGWHEEL_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/Timestamp.h"
+
+#include <vector>
+
+namespace muduo
+{
+namespace net
+{
+
+class Timer;
+
+///
+/// Hierarchical timing wheel of 1ms ticks, O(1) insert and remove.
+/// Timers are linked into slots through their own fields, the wheel
+/// allocates nothing.
+///
+/// Level 0 has one slot per tick, a slot of level n spans 64^n ticks and
+/// is cascaded into lower levels when its time comes. Timers beyond the
+/// last level (about 12 days) are parked there and cascaded again.
+/// Not thread safe, owned by TimerQueue.
+class TimingWheel : noncopyable
+{
+ public:
+  static const int64_t kTickMicroSeconds = 1000;
+  static const int kSlotBits = 6;
+  static const int kSlots = 1 << kSlotBits;
+  static const int kLevels = 5;
+
+  explicit TimingWheel(Timestamp now);
+  ~TimingWheel();  // deletes timers left in the wheel
+
+  /// Takes ownership of @c timer until it expires or is removed.
+  void insert(Timer* timer);
+
+  /// Returns false if the timer is not in the wheel (any more),
+  /// otherwise the caller owns it again.
+  /// @c timer must point to a Timer, which TimerQueue guarantees by
+  /// recycling timers rather than deleting them, see Timer::retire().
+  bool remove(Timer* timer, int64_t sequence);
+
+  /// Moves out timers expired at @c now, in order of expiration.
+  void advance(Timestamp now, std::vector<Timer*>* expired);
+
+  /// When advance() has work to do next, invalid if the wheel is empty.
+  /// It may be a cascade rather than an expiration.
+  Timestamp nextEventTime() const;
+
+  size_t size() const { return size_; }
+
+ private:
+  void place(Timer* timer, int64_t tick);
+  void unlink(Timer* timer);
+  void cascade(int level, int slot);
+  int64_t nextEventTick() const;
+
+  int64_t currentTick_;  // all ticks up to it have been processed
+  Timer* slots_[kLevels][kSlots];
+  uint64_t occupied_[kLevels];  // bitmap of non-empty slots per level
+  size_t size_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_TIMINGWHEEL_H
@@ -0,0 +1,90 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/UdpServer.h"
+
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThreadPool.h"
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+void destroySocket(UdpSocket* socket, CountDownLatch* latch)
+{
+  delete socket;
+  latch->countDown();
+}
+}  // namespace
+
+UdpServer::UdpServer(EventLoop* loop,
+                     const InetAddress& listenAddr,
+                     const string& nameArg,
+                     Option option)
+  : loop_(CHECK_NOTNULL(loop)),
+    listenAddr_(listenAddr),
+    ipPort_(listenAddr.toIpPort()),
+    name_(nameArg),
+    reuseport_(option == kReusePort),
+    threadPool_(new EventLoopThreadPool(loop, name_)),
+    batchSize_(UdpSocket::kDefaultBatchSize),
+    maxDatagramSize_(UdpSocket::kDefaultMaxDatagramSize)
+{
+}
+
+UdpServer::~UdpServer()
+{
+  loop_->assertInLoopThread();
+  LOG_TRACE << "UdpServer::~UdpServer [" << name_ << "] destructing";
+
+  if (!sockets_.empty())
+  {
+    CountDownLatch latch(static_cast<int>(sockets_.size()));
+    for (UdpSocket* socket : sockets_)
+    {
+      socket->getLoop()->runInLoop(std::bind(destroySocket, socket, &latch));
+    }
+    latch.wait();
+  }
+}
+
+void UdpServer::setThreadNum(int numThreads)
+{
+  assert(0 <= numThreads);
+  threadPool_->setThreadNum(numThreads);
+}
+
+void UdpServer::start()
+{
+  if (started_.getAndSet(1) == 0)
+  {
+    threadPool_->start(threadInitCallback_);
+    std::vector<EventLoop*> loops;
+    if (reuseport_)
+    {
+      loops = threadPool_->getAllLoops();
+    }
+    else
+    {
+      loops.push_back(threadPool_->getNextLoop());
+    }
+    for (EventLoop* ioLoop : loops)
+    {
+      UdpSocket* socket = new UdpSocket(ioLoop, listenAddr_, reuseport_,
+                                        batchSize_, maxDatagramSize_);
+      socket->setBatchCallback(batchCallback_);
+      ioLoop->runInLoop(std::bind(&UdpSocket::start, socket));
+      sockets_.push_back(socket);
+    }
+    LOG_INFO << "UdpServer::start [" << name_ << "] - " << sockets_.size()
+             << " socket(s) on " << ipPort_;
+  }
+}
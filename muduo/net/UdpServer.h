@@ -0,0 +1,102 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_UDPSERVER_H
+#define MUDUO_NET_UDPSERVER_H
+
+#include "muduo/base/Atomic.h"
+#include "muduo/base/Types.h"
+#include "muduo/net/UdpSocket.h"
+
+#include <vector>
+
+namespace muduo
+{
+namespace net
+{
+
+class EventLoop;
+class EventLoopThreadPool;
+
+///
+/// UDP server, supports single-threaded and thread-pool models.
+///
+/// Datagrams are handed to the batch callback as they come out of one
+/// recvmmsg(2), replies sent with UdpSocket::sendTo() in the callback
+/// go out with one sendmmsg(2).
+class UdpServer : noncopyable
+{
+ public:
+  typedef std::function<void(EventLoop*)> ThreadInitCallback;
+  enum Option
+  {
+    // one socket, read in one of the loops
+    kNoReusePort,
+    // every loop reads its own SO_REUSEPORT socket, the kernel spreads
+    // datagrams among them by hash of peer address.
+    // The port of listenAddr must not be 0.
+    kReusePort,
+  };
+
+  UdpServer(EventLoop* loop,
+            const InetAddress& listenAddr,
+            const string& nameArg,
+            Option option = kNoReusePort);
+  ~UdpServer();  // force out-line dtor, for std::unique_ptr members.
+
+  const string& ipPort() const { return ipPort_; }
+  const string& name() const { return name_; }
+  EventLoop* getLoop() const { return loop_; }
+
+  /// Set the number of threads for handling input, see TcpServer.
+  /// Must be called before @c start
+  void setThreadNum(int numThreads);
+  void setThreadInitCallback(const ThreadInitCallback& cb)
+  { threadInitCallback_ = cb; }
+
+  /// Datagrams per recvmmsg(2) and sendmmsg(2), and size of the largest
+  /// one accepted, larger ones are dropped.
+  /// Must be called before @c start
+  void setBatchSize(int batchSize, size_t maxDatagramSize = UdpSocket::kDefaultMaxDatagramSize)
+  { batchSize_ = batchSize; maxDatagramSize_ = maxDatagramSize; }
+
+  /// Not thread safe, called in the loop of each socket.
+  /// Must be called before @c start
+  void setBatchCallback(const UdpSocket::BatchCallback& cb)
+  { batchCallback_ = cb; }
+
+  /// Starts the server if it's not listening.
+  ///
+  /// It's harmless to call it multiple times.
+  /// Must be called in loop thread.
+  void start();
+
+  /// sockets are valid after calling start(), one per loop with kReusePort.
+  const std::vector<UdpSocket*>& sockets() const { return sockets_; }
+
+ private:
+  EventLoop* loop_;  // the acceptor loop
+  const InetAddress listenAddr_;
+  const string ipPort_;
+  const string name_;
+  const bool reuseport_;
+  std::shared_ptr<EventLoopThreadPool> threadPool_;
+  ThreadInitCallback threadInitCallback_;
+  UdpSocket::BatchCallback batchCallback_;
+  int batchSize_;
+  size_t maxDatagramSize_;
+  AtomicInt32 started_;
+  std::vector<UdpSocket*> sockets_;  // owned, destroyed in their loops
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_UDPSERVER_H
@@ -0,0 +1,220 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/UdpSocket.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/Channel.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/Socket.h"
+#include "muduo/net/SocketsOps.h"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+const int UdpSocket::kDefaultBatchSize;
+const size_t UdpSocket::kDefaultMaxDatagramSize;
+
+// one mmsghdr per datagram, each owns a slot of storage
+struct UdpSocket::Batch
+{
+  Batch(int batchSize, size_t maxDatagramSize)
+    : storage(batchSize * maxDatagramSize),
+      msgs(batchSize),
+      iovecs(batchSize),
+      addrs(batchSize)
+  {
+    memZero(msgs.data(), msgs.size() * sizeof msgs[0]);
+    memZero(addrs.data(), addrs.size() * sizeof addrs[0]);
+    for (int i = 0; i < batchSize; ++i)
+    {
+      iovecs[i].iov_base = &storage[i * maxDatagramSize];
+      iovecs[i].iov_len = maxDatagramSize;
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = &addrs[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof addrs[i];
+    }
+  }
+
+  std::vector<char> storage;
+  std::vector<struct mmsghdr> msgs;
+  std::vector<struct iovec> iovecs;
+  std::vector<struct sockaddr_in6> addrs;
+};
+
+UdpSocket::UdpSocket(EventLoop* loop,
+                     const InetAddress& bindAddr,
+                     bool reuseport,
+                     int batchSize,
+                     size_t maxDatagramSize)
+  : loop_(CHECK_NOTNULL(loop)),
+    socket_(new Socket(sockets::createUdpNonblockingOrDie(bindAddr.family()))),
+    channel_(new Channel(loop, socket_->fd())),
+    batchSize_(batchSize),
+    maxDatagramSize_(maxDatagramSize),
+    recvBatch_(new Batch(batchSize, maxDatagramSize)),
+    sendBatch_(new Batch(batchSize, maxDatagramSize)),
+    datagrams_(batchSize),
+    sendCount_(0),
+    started_(false),
+    inCallback_(false),
+    datagramsReceived_(0),
+    datagramsSent_(0),
+    datagramsDropped_(0),
+    recvCalls_(0),
+    sendCalls_(0)
+{
+  assert(batchSize > 0);
+  socket_->setReuseAddr(true);
+  socket_->setReusePort(reuseport);
+  socket_->bindAddress(bindAddr);
+  channel_->setReadCallback(
+      std::bind(&UdpSocket::handleRead, this, _1));
+}
+
+UdpSocket::~UdpSocket()
+{
+  if (started_)
+  {
+    loop_->assertInLoopThread();
+    channel_->disableAll();
+    channel_->remove();
+  }
+}
+
+int UdpSocket::fd() const
+{
+  return socket_->fd();
+}
+
+InetAddress UdpSocket::localAddress() const
+{
+  return InetAddress(sockets::getLocalAddr(socket_->fd()));
+}
+
+void UdpSocket::start()
+{
+  loop_->assertInLoopThread();
+  assert(!started_);
+  started_ = true;
+  channel_->enableReading();
+}
+
+void UdpSocket::handleRead(Timestamp receiveTime)
+{
+  loop_->assertInLoopThread();
+  std::vector<struct mmsghdr>& msgs = recvBatch_->msgs;
+  for (int i = 0; i < batchSize_; ++i)
+  {
+    msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in6);
+  }
+  // one batch per wakeup, level-triggered poller reports the rest
+  int n = ::recvmmsg(socket_->fd(), msgs.data(), batchSize_, MSG_DONTWAIT, NULL);
+  ++recvCalls_;
+  if (n < 0)
+  {
+    if (errno != EAGAIN && errno != EINTR)
+    {
+      LOG_SYSERR << "UdpSocket::handleRead";
+    }
+    return;
+  }
+
+  int count = 0;
+  for (int i = 0; i < n; ++i)
+  {
+    if (msgs[i].msg_hdr.msg_flags & MSG_TRUNC)
+    {
+      LOG_TRACE << "fd " << socket_->fd() << " drops a datagram larger than "
+                << maxDatagramSize_;
+      ++datagramsDropped_;
+      continue;
+    }
+    Datagram& datagram = datagrams_[count++];
+    datagram.data = static_cast<const char*>(recvBatch_->iovecs[i].iov_base);
+    datagram.length = msgs[i].msg_len;
+    datagram.peer.setSockAddrInet6(recvBatch_->addrs[i]);
+  }
+  datagramsReceived_ += count;
+
+  if (count > 0 && batchCallback_)
+  {
+    inCallback_ = true;
+    batchCallback_(this, datagrams_.data(), count, receiveTime);
+    inCallback_ = false;
+  }
+  flush();
+}
+
+void UdpSocket::sendTo(const StringPiece& data, const InetAddress& peer)
+{
+  loop_->assertInLoopThread();
+  const size_t len = static_cast<size_t>(data.size());
+  if (len > maxDatagramSize_)
+  {
+    // doesn't fit a slot, keep the order and send it alone
+    flush();
+    ++sendCalls_;
+    if (::sendto(socket_->fd(), data.data(), len, 0, peer.getSockAddr(),
+                 static_cast<socklen_t>(sizeof(struct sockaddr_in6))) < 0)
+    {
+      LOG_SYSERR << "UdpSocket::sendTo";
+      ++datagramsDropped_;
+    }
+    else
+    {
+      ++datagramsSent_;
+    }
+    return;
+  }
+
+  const int i = sendCount_++;
+  memcpy(sendBatch_->iovecs[i].iov_base, data.data(), len);
+  sendBatch_->iovecs[i].iov_len = len;
+  memcpy(&sendBatch_->addrs[i], peer.getSockAddr(), sizeof(struct sockaddr_in6));
+  if (!inCallback_ || sendCount_ == batchSize_)
+  {
+    flush();
+  }
+}
+
+void UdpSocket::flush()
+{
+  loop_->assertInLoopThread();
+  int sent = 0;
+  while (sent < sendCount_)
+  {
+    int n = ::sendmmsg(socket_->fd(), &sendBatch_->msgs[sent], sendCount_ - sent, 0);
+    ++sendCalls_;
+    if (n > 0)
+    {
+      sent += n;
+      datagramsSent_ += n;
+    }
+    else if (n < 0 && (errno == EAGAIN || errno == ENOBUFS))
+    {
+      // send buffer is full, it's UDP
+      LOG_TRACE << "fd " << socket_->fd() << " drops " << sendCount_ - sent << " datagrams";
+      datagramsDropped_ += sendCount_ - sent;
+      break;
+    }
+    else
+    {
+      // e.g. unreachable peer, skip that datagram
+      LOG_SYSERR << "UdpSocket::flush";
+      ++sent;
+      ++datagramsDropped_;
+    }
+  }
+  sendCount_ = 0;
+}
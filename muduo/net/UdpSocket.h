@@ -0,0 +1,121 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_UDPSOCKET_H
+#define MUDUO_NET_UDPSOCKET_H
+
+#include "muduo/base/noncopyable.h"
+#include "muduo/base/StringPiece.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/InetAddress.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace muduo
+{
+namespace net
+{
+
+class Channel;
+class EventLoop;
+class Socket;
+
+///
+/// A received datagram, points into storage of UdpSocket,
+/// valid only during the batch callback.
+///
+struct Datagram
+{
+  const char* data;
+  size_t length;
+  InetAddress peer;
+};
+
+///
+/// Non-blocking UDP socket of an EventLoop, reads with recvmmsg(2)
+/// and writes with sendmmsg(2), a batch at a time.
+///
+/// Receive and send storage is allocated once, no allocation per datagram.
+/// Not thread safe, use it in its loop thread, except ctor.
+class UdpSocket : noncopyable
+{
+ public:
+  typedef std::function<void (UdpSocket*,
+                              const Datagram* datagrams,
+                              int count,
+                              Timestamp receiveTime)> BatchCallback;
+
+  static const int kDefaultBatchSize = 64;
+  static const size_t kDefaultMaxDatagramSize = 2048;
+
+  /// Binds to @c bindAddr, port 0 picks an ephemeral one.
+  UdpSocket(EventLoop* loop,
+            const InetAddress& bindAddr,
+            bool reuseport,
+            int batchSize = kDefaultBatchSize,
+            size_t maxDatagramSize = kDefaultMaxDatagramSize);
+  ~UdpSocket();  // must be destroyed in loop thread if started
+
+  void setBatchCallback(const BatchCallback& cb)
+  { batchCallback_ = cb; }
+
+  /// Starts reading, must be called in loop thread.
+  void start();
+
+  /// Datagrams sent in the batch callback are queued and written with
+  /// one sendmmsg(2) after it returns, otherwise they are written right away.
+  /// @c data is copied, must be called in loop thread.
+  void sendTo(const StringPiece& data, const InetAddress& peer);
+
+  /// Writes queued datagrams now.
+  void flush();
+
+  EventLoop* getLoop() const { return loop_; }
+  int fd() const;
+  InetAddress localAddress() const;
+
+  // counters, updated in loop thread
+  int64_t datagramsReceived() const { return datagramsReceived_; }
+  int64_t datagramsSent() const { return datagramsSent_; }
+  /// truncated on receive, or send buffer full
+  int64_t datagramsDropped() const { return datagramsDropped_; }
+  int64_t recvCalls() const { return recvCalls_; }
+  int64_t sendCalls() const { return sendCalls_; }
+
+ private:
+  struct Batch;
+
+  void handleRead(Timestamp receiveTime);
+
+  EventLoop* loop_;
+  std::unique_ptr<Socket> socket_;
+  std::unique_ptr<Channel> channel_;
+  const int batchSize_;
+  const size_t maxDatagramSize_;
+  std::unique_ptr<Batch> recvBatch_;
+  std::unique_ptr<Batch> sendBatch_;
+  std::vector<Datagram> datagrams_;
+  int sendCount_;
+  bool started_;
+  bool inCallback_;
+  BatchCallback batchCallback_;
+  int64_t datagramsReceived_;
+  int64_t datagramsSent_;
+  int64_t datagramsDropped_;
+  int64_t recvCalls_;
+  int64_t sendCalls_;
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_UDPSOCKET_H
@@ -8,11 +8,24 @@
 //
 
 #include "muduo/net/Buffer.h"
+#include "muduo/net/StringSearch.h"
 #include "muduo/net/http/HttpContext.h"
 
+#include <ctype.h>
+#include <string.h>
+#include <strings.h>
+
 using namespace muduo;
 using namespace muduo::net;
 
+namespace
+{
+
+const char kCRLF[] = "\r\n";
+const char kCRLFCRLF[] = "\r\n\r\n";
+
+}  // namespace
+
 bool HttpContext::processRequestLine(const char* begin, const char* end)
 {
   bool succeed = false;
@@ -25,7 +38,12 @@ bool HttpContext::processRequestLine(const char* begin, const char* end)
     if (space != end)
     {
       const char* question = std::find(start, space, '?');
-      if (question != space)
+      if (request_.isView())
+      {
+        request_.setPathView(start, question);
+        request_.setQueryView(question, space);
+      }
+      else if (question != space)
       {
         request_.setPath(start, question);
         request_.setQuery(question, space);
@@ -56,6 +74,165 @@ bool HttpContext::processRequestLine(const char* begin, const char* end)
   return succeed;
 }
 
+// [begin, end) is request line and headers, up to and including the
+// CRLF of last header line.
+bool HttpContext::processHeaderBlock(const char* begin, const char* end)
+{
+  request_.setHeaderBlock(begin, end - begin);
+  const char* crlf = search::find(begin, end, kCRLF, 2);
+  assert(crlf != NULL);
+  if (!processRequestLine(begin, crlf))
+  {
+    return false;
+  }
+  for (const char* line = crlf + 2; line < end; line = crlf + 2)
+  {
+    crlf = search::find(line, end, kCRLF, 2);
+    assert(crlf != NULL);
+    const char* colon = std::find(line, crlf, ':');
+    if (colon != crlf)
+    {
+      request_.addHeaderView(line, colon, crlf);
+    }
+  }
+  return true;
+}
+
+// pending bytes of request line or headers are about to be consumed,
+// or are all there is so far
+bool HttpContext::checkHeaderSize(size_t pending)
+{
+  if (headerBytes_ + pending > maxHeaderSize_)
+  {
+    headerTooLarge_ = true;
+  }
+  return !headerTooLarge_;
+}
+
+namespace
+{
+
+const size_t kMaxChunkLine = 1024;
+
+bool containsToken(const StringPiece& value, const char* token)
+{
+  const size_t len = strlen(token);
+  for (const char* p = value.begin(); p + len <= value.end(); ++p)
+  {
+    if (::strncasecmp(p, token, len) == 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+bool HttpContext::startBody()
+{
+  // header names are case-insensitive
+  const StringPiece transferEncoding = request_.headerView("Transfer-Encoding");
+  const StringPiece contentLength = request_.headerView("Content-Length");
+  if (containsToken(transferEncoding, "chunked"))
+  {
+    state_ = kExpectChunkSize;
+  }
+  else if (contentLength.data() != NULL)
+  {
+    if (contentLength.empty() || contentLength.size() > 19)
+    {
+      return false;
+    }
+    remaining_ = 0;
+    for (const char* p = contentLength.begin(); p != contentLength.end(); ++p)
+    {
+      if (!isdigit(*p))
+      {
+        return false;
+      }
+      remaining_ = remaining_ * 10 + (*p - '0');
+    }
+    if (remaining_ > maxBodySize_)
+    {
+      bodyTooLarge_ = true;
+      return false;
+    }
+    state_ = remaining_ > 0 ? kExpectBody : kGotAll;
+  }
+  else
+  {
+    state_ = kGotAll;
+  }
+
+  if (state_ != kGotAll && request_.getVersion() == HttpRequest::kHttp11)
+  {
+    const StringPiece expect = request_.headerView("Expect");
+    needContinue_ = expect.size() == 12
+        && ::strncasecmp(expect.data(), "100-continue", 12) == 0;
+  }
+  return true;
+}
+
+void HttpContext::deliverBody(const char* data, size_t len)
+{
+  bodyBytes_ += len;
+  if (bodyCallback_)
+  {
+    bodyCallback_(&request_, StringPiece(data, static_cast<int>(len)));
+  }
+  else
+  {
+    request_.appendBody(data, len);
+  }
+}
+
+// Content-Length body, or data of a chunk, as much as buffered
+bool HttpContext::processBody(Buffer* buf)
+{
+  const size_t n = std::min(remaining_, buf->readableBytes());
+  if (n > 0)
+  {
+    deliverBody(buf->peek(), n);
+    buf->retrieve(n);
+    remaining_ -= n;
+  }
+  if (remaining_ > 0)
+  {
+    return false;
+  }
+  state_ = state_ == kExpectBody ? kGotAll : kExpectChunkCRLF;
+  return state_ != kGotAll;
+}
+
+// "1a2b;name=value", extensions ignored
+bool HttpContext::processChunkSize(const char* begin, const char* end)
+{
+  const char* p = begin;
+  size_t size = 0;
+  for (; p < end && isxdigit(*p); ++p)
+  {
+    if (size >> 60)
+    {
+      return false;
+    }
+    const char c = *p;
+    size = size * 16 + (isdigit(c) ? c - '0' : (tolower(c) - 'a' + 10));
+  }
+  if (p == begin || (p != end && *p != ';' && *p != ' ' && *p != '\t'))
+  {
+    return false;
+  }
+  if (size > maxBodySize_ - bodyBytes_)
+  {
+    bodyTooLarge_ = true;
+    return false;
+  }
+  remaining_ = size;
+  state_ = size > 0 ? kExpectChunkData : kExpectTrailers;
+  return true;
+}
+
 // return false if any error
 bool HttpContext::parseRequest(Buffer* buf, Timestamp receiveTime)
 {
@@ -63,15 +240,39 @@ bool HttpContext::parseRequest(Buffer* buf, Timestamp receiveTime)
   bool hasMore = true;
   while (hasMore)
   {
-    if (state_ == kExpectRequestLine)
+    if (state_ == kExpectRequestLine && zeroCopy_)
+    {
+      const char* blockEnd = buf->findDelimiter(kCRLFCRLF);
+      if (blockEnd)
+      {
+        ok = checkHeaderSize(blockEnd + 4 - buf->peek())
+            && processHeaderBlock(buf->peek(), blockEnd + 2);
+        if (ok)
+        {
+          request_.setReceiveTime(receiveTime);
+          headerBytes_ += blockEnd + 4 - buf->peek();
+          buf->retrieveUntil(blockEnd + 4);
+          ok = startBody();
+        }
+        hasMore = ok && state_ != kGotAll;
+      }
+      else
+      {
+        ok = checkHeaderSize(buf->readableBytes());
+        hasMore = false;
+      }
+    }
+    else if (state_ == kExpectRequestLine)
     {
       const char* crlf = buf->findCRLF();
       if (crlf)
       {
-        ok = processRequestLine(buf->peek(), crlf);
+        ok = checkHeaderSize(crlf + 2 - buf->peek())
+            && processRequestLine(buf->peek(), crlf);
         if (ok)
         {
           request_.setReceiveTime(receiveTime);
+          headerBytes_ += crlf + 2 - buf->peek();
           buf->retrieveUntil(crlf + 2);
           state_ = kExpectHeaders;
         }
@@ -82,13 +283,19 @@ bool HttpContext::parseRequest(Buffer* buf, Timestamp receiveTime)
       }
       else
       {
+        ok = checkHeaderSize(buf->readableBytes());
         hasMore = false;
       }
     }
     else if (state_ == kExpectHeaders)
     {
       const char* crlf = buf->findCRLF();
-      if (crlf)
+      if (crlf && !checkHeaderSize(crlf + 2 - buf->peek()))
+      {
+        ok = false;
+        hasMore = false;
+      }
+      else if (crlf)
       {
         const char* colon = std::find(buf->peek(), crlf, ':');
         if (colon != crlf)
@@ -98,21 +305,85 @@ bool HttpContext::parseRequest(Buffer* buf, Timestamp receiveTime)
         else
         {
           // empty line, end of header
-          // FIXME:
+          ok = startBody();
+          hasMore = ok && state_ != kGotAll;
+        }
+        headerBytes_ += crlf + 2 - buf->peek();
+        buf->retrieveUntil(crlf + 2);
+      }
+      else
+      {
+        ok = checkHeaderSize(buf->readableBytes());
+        hasMore = false;
+      }
+    }
+    else if (state_ == kExpectBody || state_ == kExpectChunkData)
+    {
+      hasMore = processBody(buf);
+    }
+    else if (state_ == kExpectChunkSize)
+    {
+      const char* crlf = buf->findCRLF();
+      if (crlf)
+      {
+        ok = processChunkSize(buf->peek(), crlf);
+        hasMore = ok;
+        buf->retrieveUntil(crlf + 2);
+      }
+      else
+      {
+        ok = buf->readableBytes() <= kMaxChunkLine;
+        hasMore = false;
+      }
+    }
+    else if (state_ == kExpectChunkCRLF)
+    {
+      if (buf->readableBytes() >= 2)
+      {
+        ok = buf->peek()[0] == '\r' && buf->peek()[1] == '\n';
+        buf->retrieve(2);
+        state_ = kExpectChunkSize;
+        hasMore = ok;
+      }
+      else
+      {
+        hasMore = false;
+      }
+    }
+    else if (state_ == kExpectTrailers)
+    {
+      // trailers are dropped, up to the empty line, and count as headers
+      const char* crlf = buf->findCRLF();
+      if (crlf && !checkHeaderSize(crlf + 2 - buf->peek()))
+      {
+        ok = false;
+        hasMore = false;
+      }
+      else if (crlf)
+      {
+        if (crlf == buf->peek())
+        {
           state_ = kGotAll;
           hasMore = false;
         }
+        headerBytes_ += crlf + 2 - buf->peek();
         buf->retrieveUntil(crlf + 2);
       }
       else
       {
+        ok = checkHeaderSize(buf->readableBytes());
         hasMore = false;
       }
     }
-    else if (state_ == kExpectBody)
+    else
     {
-      // FIXME:
+      hasMore = false;
     }
   }
+  if (ok && request_.isView() && !expectingHeaders() && !gotAll())
+  {
+    // body spans reads, input buffer may be moved by next read
+    request_.ownHeaderBlock();
+  }
   return ok;
 }
@@ -12,15 +12,20 @@
 #define MUDUO_NET_HTTP_HTTPCONTEXT_H
 
 #include "muduo/base/copyable.h"
+#include "muduo/base/StringPiece.h"
 
 #include "muduo/net/http/HttpRequest.h"
 
+#include <functional>
+#include <memory>
+
 namespace muduo
 {
 namespace net
 {
 
 class Buffer;
+class HttpResponse;
 
 class HttpContext : public muduo::copyable
 {
@@ -31,13 +36,53 @@ class HttpContext : public muduo::copyable
     kExpectHeaders,
     kExpectBody,
     kGotAll,
+    kExpectChunkSize,
+    kExpectChunkData,
+    kExpectChunkCRLF,
+    kExpectTrailers,
   };
 
+  /// Gets body pieces straight from the input buffer, instead of
+  /// collecting them into HttpRequest::body().
+  typedef std::function<void (HttpRequest*, const StringPiece&)> BodyCallback;
+
+  static const size_t kDefaultMaxBodySize = 1024*1024;
+  static const size_t kDefaultMaxHeaderSize = 8192;
+
   HttpContext()
-    : state_(kExpectRequestLine)
+    : state_(kExpectRequestLine),
+      headerBytes_(0),
+      maxHeaderSize_(kDefaultMaxHeaderSize),
+      maxBodySize_(kDefaultMaxBodySize),
+      bodyBytes_(0),
+      remaining_(0),
+      headerTooLarge_(false),
+      bodyTooLarge_(false),
+      needContinue_(false),
+      zeroCopy_(false)
   {
   }
 
+  /// Limits request line plus headers, complete or not, and trailers
+  /// of a chunked body.
+  void setMaxHeaderSize(size_t bytes)
+  { maxHeaderSize_ = bytes; }
+
+  void setMaxBodySize(size_t bytes)
+  { maxBodySize_ = bytes; }
+
+  void setBodyCallback(const BodyCallback& cb)
+  { bodyCallback_ = cb; }
+
+  /// Parses request line and headers in place once the whole header
+  /// block is buffered, request() then holds views into @c buf,
+  /// see HttpRequest::isView().
+  void setZeroCopy(bool on)
+  { zeroCopy_ = on; }
+
+  bool zeroCopy() const
+  { return zeroCopy_; }
+
   // default copy-ctor, dtor and assignment are fine
 
   // return false if any error
@@ -46,13 +91,51 @@ class HttpContext : public muduo::copyable
   bool gotAll() const
   { return state_ == kGotAll; }
 
+  /// Still in request line or headers, not in body.
+  bool expectingHeaders() const
+  { return state_ == kExpectRequestLine || state_ == kExpectHeaders; }
+
+  /// parseRequest() failed as request line, headers and trailers exceed
+  /// max header size.
+  bool headerTooLarge() const
+  { return headerTooLarge_; }
+
+  /// parseRequest() failed as body exceeds max body size.
+  bool bodyTooLarge() const
+  { return bodyTooLarge_; }
+
+  /// Client sent "Expect: 100-continue" and waits before sending body.
+  bool needContinue() const
+  { return needContinue_; }
+
+  void continueSent()
+  { needContinue_ = false; }
+
+  /// Bytes of request line and headers consumed so far.
+  size_t headerBytes() const
+  { return headerBytes_; }
+
   void reset()
   {
     state_ = kExpectRequestLine;
+    headerBytes_ = 0;
+    bodyBytes_ = 0;
+    remaining_ = 0;
+    headerTooLarge_ = false;
+    bodyTooLarge_ = false;
+    needContinue_ = false;
     HttpRequest dummy;
     request_.swap(dummy);
   }
 
+  /// Response whose body is being sent, requests pipelined after it
+  /// wait in input buffer. Survives reset().
+  void setStreamingResponse(const std::shared_ptr<HttpResponse>& response)
+  { streamingResponse_ = response; }
+
+  const std::shared_ptr<HttpResponse>& streamingResponse() const
+  { return streamingResponse_; }
+
   const HttpRequest& request() const
   { return request_; }
 
@@ -61,8 +144,25 @@ class HttpContext : public muduo::copyable
 
  private:
   bool processRequestLine(const char* begin, const char* end);
+  bool processHeaderBlock(const char* begin, const char* end);
+  bool checkHeaderSize(size_t pending);
+  bool startBody();
+  bool processBody(Buffer* buf);
+  bool processChunkSize(const char* begin, const char* end);
+  void deliverBody(const char* data, size_t len);
 
   HttpRequestParseState state_;
+  size_t headerBytes_;
+  size_t maxHeaderSize_;
+  size_t maxBodySize_;
+  size_t bodyBytes_;
+  size_t remaining_;  // of body, or of current chunk
+  bool headerTooLarge_;
+  bool bodyTooLarge_;
+  bool needContinue_;
+  bool zeroCopy_;
+  BodyCallback bodyCallback_;
+  std::shared_ptr<HttpResponse> streamingResponse_;
   HttpRequest request_;
 };
 
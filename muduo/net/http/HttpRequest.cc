@@ -0,0 +1,167 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+
+#include "muduo/net/http/HttpRequest.h"
+
+#include <algorithm>
+
+#include <ctype.h>
+#include <strings.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+
+// FNV-1a over ASCII lower case, 'A' | 0x20 == 'a'
+uint32_t hashField(const char* p, size_t len)
+{
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; ++i)
+  {
+    h ^= static_cast<unsigned char>(p[i] | 0x20);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+bool equalsIgnoreCase(const StringPiece& lhs, const StringPiece& rhs)
+{
+  return lhs.size() == rhs.size()
+      && ::strncasecmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+}
+
+}  // namespace
+
+HttpRequest::HttpRequest(const HttpRequest& rhs)
+  : method_(rhs.method_),
+    version_(rhs.version_),
+    path_(rhs.path_),
+    query_(rhs.query_),
+    receiveTime_(rhs.receiveTime_),
+    headers_(rhs.headers_),
+    body_(rhs.body_),
+    context_(rhs.context_),
+    base_(NULL),
+    blockLength_(0),
+    numHeaders_(0)
+{
+  copyViews(rhs);
+}
+
+HttpRequest& HttpRequest::operator=(const HttpRequest& rhs)
+{
+  if (this != &rhs)
+  {
+    HttpRequest copy(rhs);
+    swap(copy);
+  }
+  return *this;
+}
+
+void HttpRequest::copyViews(const HttpRequest& rhs)
+{
+  // a copy always owns its header block, views are offsets so they carry over
+  if (rhs.isView())
+  {
+    ownedBlock_.assign(rhs.base_, rhs.blockLength_);
+    base_ = ownedBlock_.data();
+    blockLength_ = rhs.blockLength_;
+    pathField_ = rhs.pathField_;
+    queryField_ = rhs.queryField_;
+    numHeaders_ = rhs.numHeaders_;
+    std::copy(rhs.inlineHeaders_, rhs.inlineHeaders_ + kInlineHeaders, inlineHeaders_);
+    moreHeaders_ = rhs.moreHeaders_;
+  }
+}
+
+void HttpRequest::swapViews(HttpRequest& that)
+{
+  const bool thisOwned = base_ != NULL && base_ == ownedBlock_.data();
+  const bool thatOwned = that.base_ != NULL && that.base_ == that.ownedBlock_.data();
+  ownedBlock_.swap(that.ownedBlock_);
+  std::swap(base_, that.base_);
+  // SSO strings move their bytes on swap
+  if (thisOwned)
+  {
+    that.base_ = that.ownedBlock_.data();
+  }
+  if (thatOwned)
+  {
+    base_ = ownedBlock_.data();
+  }
+  std::swap(blockLength_, that.blockLength_);
+  std::swap(pathField_, that.pathField_);
+  std::swap(queryField_, that.queryField_);
+  std::swap(numHeaders_, that.numHeaders_);
+  std::swap(inlineHeaders_, that.inlineHeaders_);
+  moreHeaders_.swap(that.moreHeaders_);
+}
+
+void HttpRequest::addHeaderView(const char* start, const char* colon, const char* end)
+{
+  const char* value = colon + 1;
+  while (value < end && isspace(*value))
+  {
+    ++value;
+  }
+  while (end > value && isspace(end[-1]))
+  {
+    --end;
+  }
+  Header header;
+  header.name = fieldOf(start, colon);
+  header.value = fieldOf(value, end);
+  header.hash = hashField(start, colon - start);
+  if (numHeaders_ < kInlineHeaders)
+  {
+    inlineHeaders_[numHeaders_] = header;
+  }
+  else
+  {
+    moreHeaders_.push_back(header);
+  }
+  ++numHeaders_;
+}
+
+StringPiece HttpRequest::headerView(const StringPiece& field) const
+{
+  if (!isView())
+  {
+    for (const auto& header : headers_)
+    {
+      if (equalsIgnoreCase(header.first, field))
+      {
+        return header.second;
+      }
+    }
+    return StringPiece();
+  }
+
+  const uint32_t hash = hashField(field.data(), field.size());
+  for (int i = 0; i < numHeaders_; ++i)
+  {
+    const Header& header = headerAt(i);
+    if (header.hash == hash && equalsIgnoreCase(piece(header.name), field))
+    {
+      return piece(header.value);
+    }
+  }
+  return StringPiece();
+}
+
+void HttpRequest::ownHeaderBlock()
+{
+  if (isView() && base_ != ownedBlock_.data())
+  {
+    ownedBlock_.assign(base_, blockLength_);
+    base_ = ownedBlock_.data();
+  }
+}
@@ -12,10 +12,14 @@
 #define MUDUO_NET_HTTP_HTTPREQUEST_H
 
 #include "muduo/base/copyable.h"
+#include "muduo/base/StringPiece.h"
 #include "muduo/base/Timestamp.h"
 #include "muduo/base/Types.h"
 
+#include <boost/any.hpp>
+
 #include <map>
+#include <vector>
 #include <assert.h>
 #include <stdio.h>
 
@@ -24,6 +28,15 @@ namespace muduo
 namespace net
 {
 
+///
+/// A parsed request, fields owned as strings by default.
+///
+/// With HttpContext::setZeroCopy(), path, query and headers are views
+/// into the header block in the input Buffer instead, read them with
+/// pathView(), queryView() and headerView(), they are valid until
+/// HttpCallback returns. path(), query(), getHeader() and headers()
+/// are empty in that mode. The header block is copied once, only if
+/// the body doesn't arrive along with it.
 class HttpRequest : public muduo::copyable
 {
  public:
@@ -38,10 +51,16 @@ class HttpRequest : public muduo::copyable
 
   HttpRequest()
     : method_(kInvalid),
-      version_(kUnknown)
+      version_(kUnknown),
+      base_(NULL),
+      blockLength_(0),
+      numHeaders_(0)
   {
   }
 
+  HttpRequest(const HttpRequest& rhs);
+  HttpRequest& operator=(const HttpRequest& rhs);
+
   void setVersion(Version v)
   {
     version_ = v;
@@ -53,7 +72,7 @@ class HttpRequest : public muduo::copyable
   bool setMethod(const char* start, const char* end)
   {
     assert(method_ == kInvalid);
-    string m(start, end);
+    const StringPiece m(start, static_cast<int>(end - start));
     if (m == "GET")
     {
       method_ = kGet;
@@ -162,6 +181,56 @@ class HttpRequest : public muduo::copyable
   const std::map<string, string>& headers() const
   { return headers_; }
 
+  bool isView() const
+  { return base_ != NULL; }
+
+  StringPiece pathView() const
+  { return isView() ? piece(pathField_) : StringPiece(path_); }
+
+  StringPiece queryView() const
+  { return isView() ? piece(queryField_) : StringPiece(query_); }
+
+  /// Case-insensitive, in either mode, empty if not found.
+  StringPiece headerView(const StringPiece& field) const;
+
+  /// Headers in the order received, in zero-copy mode.
+  int numHeaderViews() const
+  { return numHeaders_; }
+  StringPiece headerNameView(int i) const
+  { return piece(headerAt(i).name); }
+  StringPiece headerValueView(int i) const
+  { return piece(headerAt(i).value); }
+
+  // used by HttpContext in zero-copy mode
+  // all views are within the header block starting at @c base
+  void setHeaderBlock(const char* base, size_t length)
+  { base_ = base; blockLength_ = length; }
+  void setPathView(const char* start, const char* end)
+  { pathField_ = fieldOf(start, end); }
+  void setQueryView(const char* start, const char* end)
+  { queryField_ = fieldOf(start, end); }
+  void addHeaderView(const char* start, const char* colon, const char* end);
+  /// Copies the header block, as input Buffer will be overwritten.
+  void ownHeaderBlock();
+
+  /// Collected body, empty if HttpServer streams it to a BodyCallback.
+  const string& body() const
+  { return body_; }
+
+  void appendBody(const char* data, size_t len)
+  { body_.append(data, len); }
+
+  /// Per-request state of a streaming handler, e.g. the file being
+  /// written, kept from BodyCallback to HttpCallback.
+  void setContext(const boost::any& context)
+  { context_ = context; }
+
+  const boost::any& getContext() const
+  { return context_; }
+
+  boost::any* getMutableContext()
+  { return &context_; }
+
   void swap(HttpRequest& that)
   {
     std::swap(method_, that.method_);
@@ -170,15 +239,61 @@ class HttpRequest : public muduo::copyable
     query_.swap(that.query_);
     receiveTime_.swap(that.receiveTime_);
     headers_.swap(that.headers_);
+    body_.swap(that.body_);
+    context_.swap(that.context_);
+    swapViews(that);
   }
 
  private:
+  struct Field
+  {
+    uint32_t offset;
+    uint32_t length;
+  };
+
+  struct Header
+  {
+    Field name;
+    Field value;
+    uint32_t hash;  // of lower-cased name
+  };
+
+  static const int kInlineHeaders = 24;
+
+  Field fieldOf(const char* start, const char* end) const
+  {
+    assert(base_ <= start && end <= base_ + blockLength_);
+    Field field = { static_cast<uint32_t>(start - base_),
+                    static_cast<uint32_t>(end - start) };
+    return field;
+  }
+
+  StringPiece piece(const Field& field) const
+  { return StringPiece(base_ + field.offset, static_cast<int>(field.length)); }
+
+  const Header& headerAt(int i) const
+  { return i < kInlineHeaders ? inlineHeaders_[i] : moreHeaders_[i - kInlineHeaders]; }
+
+  void copyViews(const HttpRequest& rhs);
+  void swapViews(HttpRequest& that);
+
   Method method_;
   Version version_;
   string path_;
   string query_;
   Timestamp receiveTime_;
   std::map<string, string> headers_;
+  string body_;
+  boost::any context_;
+  // zero-copy mode
+  const char* base_;  // input buffer, or ownedBlock_
+  size_t blockLength_;
+  string ownedBlock_;
+  Field pathField_;
+  Field queryField_;
+  int numHeaders_;
+  Header inlineHeaders_[kInlineHeaders];
+  std::vector<Header> moreHeaders_;
 };
 
 }  // namespace net
@@ -9,39 +9,311 @@
 
 #include "muduo/net/http/HttpResponse.h"
 #include "muduo/net/Buffer.h"
+#include "muduo/net/BufferChain.h"
 
+#include <algorithm>
+
+#include <fcntl.h>
 #include <stdio.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 using namespace muduo;
 using namespace muduo::net;
 
-void HttpResponse::appendToBuffer(Buffer* output) const
+namespace
 {
-  char buf[32];
-  snprintf(buf, sizeof buf, "HTTP/1.1 %d ", statusCode_);
-  output->append(buf);
-  output->append(statusMessage_);
-  output->append("\r\n");
 
-  if (closeConnection_)
+struct StatusLine
+{
+  HttpResponse::HttpStatusCode code;
+  const char* reason;
+  const char* line;
+};
+
+// 预先拼好的状态行，省掉 snprintf。
+const StatusLine kStatusLines[] =
+{
+  { HttpResponse::k200Ok, "OK", "HTTP/1.1 200 OK\r\n" },
+  { HttpResponse::k204NoContent, "No Content", "HTTP/1.1 204 No Content\r\n" },
+  { HttpResponse::k206PartialContent, "Partial Content", "HTTP/1.1 206 Partial Content\r\n" },
+  { HttpResponse::k301MovedPermanently, "Moved Permanently", "HTTP/1.1 301 Moved Permanently\r\n" },
+  { HttpResponse::k304NotModified, "Not Modified", "HTTP/1.1 304 Not Modified\r\n" },
+  { HttpResponse::k400BadRequest, "Bad Request", "HTTP/1.1 400 Bad Request\r\n" },
+  { HttpResponse::k403Forbidden, "Forbidden", "HTTP/1.1 403 Forbidden\r\n" },
+  { HttpResponse::k404NotFound, "Not Found", "HTTP/1.1 404 Not Found\r\n" },
+  { HttpResponse::k405MethodNotAllowed, "Method Not Allowed",
+    "HTTP/1.1 405 Method Not Allowed\r\n" },
+  { HttpResponse::k413PayloadTooLarge, "Payload Too Large",
+    "HTTP/1.1 413 Payload Too Large\r\n" },
+  { HttpResponse::k416RangeNotSatisfiable, "Range Not Satisfiable",
+    "HTTP/1.1 416 Range Not Satisfiable\r\n" },
+  { HttpResponse::k431RequestHeaderFieldsTooLarge, "Request Header Fields Too Large",
+    "HTTP/1.1 431 Request Header Fields Too Large\r\n" },
+  { HttpResponse::k500InternalServerError, "Internal Server Error",
+    "HTTP/1.1 500 Internal Server Error\r\n" },
+  { HttpResponse::k503ServiceUnavailable, "Service Unavailable",
+    "HTTP/1.1 503 Service Unavailable\r\n" },
+};
+
+const StatusLine* findStatus(HttpResponse::HttpStatusCode code)
+{
+  for (const StatusLine& status : kStatusLines)
+  {
+    if (status.code == code)
+    {
+      return &status;
+    }
+  }
+  return NULL;
+}
+
+// returns the start of digits, written backwards from end
+char* formatUnsigned(size_t value, char* end)
+{
+  char* p = end;
+  do
+  {
+    *--p = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  return p;
+}
+
+struct DateCache
+{
+  time_t second;
+  int length;
+  char line[64];
+};
+
+__thread DateCache t_date = { 0, 0, { 0 } };
+
+bool parseOffset(const char* begin, const char* end, int64_t* value)
+{
+  if (begin == end || end - begin > 18)
+  {
+    return false;
+  }
+  *value = 0;
+  for (const char* p = begin; p != end; ++p)
+  {
+    if (*p < '0' || *p > '9')
+    {
+      return false;
+    }
+    *value = *value * 10 + (*p - '0');
+  }
+  return true;
+}
+
+// "bytes=0-499", "bytes=500-", "bytes=-500" of a file of @c size,
+// returns 1 if satisfiable, 0 if not, -1 if to be ignored.
+int parseRange(const StringPiece& range, int64_t size, int64_t* first, int64_t* last)
+{
+  const StringPiece kBytes("bytes=");
+  if (!range.starts_with(kBytes))
+  {
+    return -1;
+  }
+  const char* begin = range.data() + kBytes.size();
+  const char* end = range.end();
+  const char* dash = std::find(begin, end, '-');
+  if (dash == end || std::find(begin, end, ',') != end)
+  {
+    return -1;  // multiple ranges are not supported, send it all
+  }
+  if (begin == dash)
+  {
+    int64_t suffix = 0;
+    if (!parseOffset(dash + 1, end, &suffix))
+    {
+      return -1;
+    }
+    if (suffix == 0 || size == 0)
+    {
+      return 0;
+    }
+    *first = std::max<int64_t>(size - suffix, 0);
+    *last = size - 1;
+    return 1;
+  }
+  int64_t from = 0;
+  int64_t to = size - 1;
+  if (!parseOffset(begin, dash, &from))
+  {
+    return -1;
+  }
+  if (dash + 1 != end)
+  {
+    if (!parseOffset(dash + 1, end, &to) || to < from)
+    {
+      return -1;
+    }
+    to = std::min(to, size - 1);
+  }
+  if (from >= size)
+  {
+    return 0;
+  }
+  *first = from;
+  *last = to;
+  return 1;
+}
+
+}  // namespace
+
+StringPiece HttpResponse::statusLine(HttpStatusCode code)
+{
+  const StatusLine* status = findStatus(code);
+  return status ? StringPiece(status->line) : StringPiece();
+}
+
+StringPiece HttpResponse::dateHeader()
+{
+  const time_t now = ::time(NULL);
+  if (now != t_date.second || t_date.length == 0)
+  {
+    struct tm tm;
+    ::gmtime_r(&now, &tm);
+    t_date.length = static_cast<int>(::strftime(t_date.line, sizeof t_date.line,
+                                                "Date: %a, %d %b %Y %H:%M:%S GMT\r\n", &tm));
+    t_date.second = now;
+  }
+  return StringPiece(t_date.line, t_date.length);
+}
+
+void HttpResponse::addHeader(const StringPiece& key, const StringPiece& value)
+{
+  const size_t len = key.size() + 2 + value.size() + 2;
+  if (headersOverflow_.empty() && headersLength_ + len <= kInlineHeaders)
+  {
+    char* p = headers_ + headersLength_;
+    memcpy(p, key.data(), key.size());
+    p += key.size();
+    *p++ = ':';
+    *p++ = ' ';
+    memcpy(p, value.data(), value.size());
+    p += value.size();
+    *p++ = '\r';
+    *p++ = '\n';
+    headersLength_ += len;
+    return;
+  }
+  if (headersOverflow_.empty())
+  {
+    headersOverflow_.reserve(2 * (headersLength_ + len));
+    headersOverflow_.assign(headers_, headersLength_);
+  }
+  headersOverflow_.append(key.data(), key.size());
+  headersOverflow_.append(": ");
+  headersOverflow_.append(value.data(), value.size());
+  headersOverflow_.append("\r\n");
+}
+
+void HttpResponse::setBodyFile(int fd, int64_t offset, size_t length)
+{
+  file_.reset(new FileRegion(fd, offset, length));
+  stream_ = PausableStreamCallback();
+  chunked_ = false;
+}
+
+bool HttpResponse::setBodyFile(const string& path, const StringPiece& range)
+{
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
   {
-    output->append("Connection: close\r\n");
+    ::close(fd);
+    return false;
+  }
+
+  const int64_t size = st.st_size;
+  int64_t first = 0;
+  int64_t last = size - 1;
+  char value[64];
+  const int satisfiable = parseRange(range, size, &first, &last);
+  addHeader("Accept-Ranges", "bytes");
+  if (satisfiable == 0)
+  {
+    setStatusCode(k416RangeNotSatisfiable);
+    snprintf(value, sizeof value, "bytes */%jd", static_cast<intmax_t>(size));
+    addHeader("Content-Range", value);
+    setBodyRef(StringPiece());
   }
   else
   {
-    snprintf(buf, sizeof buf, "Content-Length: %zd\r\n", body_.size());
-    output->append(buf);
-    output->append("Connection: Keep-Alive\r\n");
+    if (satisfiable > 0)
+    {
+      setStatusCode(k206PartialContent);
+      snprintf(value, sizeof value, "bytes %jd-%jd/%jd", static_cast<intmax_t>(first),
+               static_cast<intmax_t>(last), static_cast<intmax_t>(size));
+      addHeader("Content-Range", value);
+    }
+    else
+    {
+      setStatusCode(k200Ok);
+    }
+    setBodyFile(fd, first, static_cast<size_t>(last + 1 - first));
   }
+  ::close(fd);
+  return true;
+}
 
-  for (const auto& header : headers_)
+void HttpResponse::appendToBuffer(Buffer* output) const
+{
+  const StatusLine* status = findStatus(statusCode_);
+  if (status && (statusMessage_.empty() || statusMessage_ == status->reason))
   {
-    output->append(header.first);
-    output->append(": ");
-    output->append(header.second);
+    output->append(status->line);
+  }
+  else
+  {
+    char code[16];
+    char* end = code + sizeof code;
+    char* begin = formatUnsigned(statusCode_, end);
+    output->append("HTTP/1.1 ");
+    output->append(begin, end - begin);
+    output->append(" ");
+    output->append(statusMessage_);
     output->append("\r\n");
   }
 
+  output->append(dateHeader());
+  const StringPiece content = body();
+  if (chunked_)
+  {
+    output->append("Transfer-Encoding: chunked\r\n");
+  }
+  else if (!closeConnection_ || file_)
+  {
+    char length[32];
+    char* end = length + sizeof length;
+    char* begin = formatUnsigned(file_ ? file_->length() : content.size(), end);
+    output->append("Content-Length: ");
+    output->append(begin, end - begin);
+    output->append("\r\n");
+  }
+  output->append(closeConnection_ ? "Connection: close\r\n"
+                                  : "Connection: Keep-Alive\r\n");
+
+  if (headersOverflow_.empty())
+  {
+    output->append(headers_, headersLength_);
+  }
+  else
+  {
+    output->append(headersOverflow_);
+  }
+
   output->append("\r\n");
-  output->append(body_);
+  if (!streaming())
+  {
+    output->append(content);
+  }
 }
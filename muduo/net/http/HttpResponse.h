@@ -12,9 +12,11 @@
 #define MUDUO_NET_HTTP_HTTPRESPONSE_H
 
 #include "muduo/base/copyable.h"
+#include "muduo/base/StringPiece.h"
 #include "muduo/base/Types.h"
 
-#include <map>
+#include <functional>
+#include <memory>
 
 namespace muduo
 {
@@ -22,27 +24,62 @@ namespace net
 {
 
 class Buffer;
+class FileRegion;
+
+/// Serializes without touching the heap for a small response:
+/// headers are formatted into an inline block as they are added,
+/// status lines are precomputed, and the Date header is formatted
+/// once per second per thread.
 class HttpResponse : public muduo::copyable
 {
  public:
+  /// Appends next piece of body to @c buf, some KiB, returns false
+  /// once the body is complete. Called in the loop thread whenever
+  /// the connection has room, until then the response is kept alive.
+  /// Must append something unless it's done, see PausableStreamCallback.
+  typedef std::function<bool (Buffer* buf)> StreamCallback;
+
+  /// Calls the body stream again, from any thread, no-op once the
+  /// connection is gone.
+  typedef std::function<void ()> ResumeCallback;
+
+  /// Same as StreamCallback, but returning true with nothing appended
+  /// pauses the stream, until @c resume is called.
+  typedef std::function<bool (Buffer* buf,
+                              const ResumeCallback& resume)> PausableStreamCallback;
+
   enum HttpStatusCode
   {
     kUnknown,
     k200Ok = 200,
+    k204NoContent = 204,
+    k206PartialContent = 206,
     k301MovedPermanently = 301,
+    k304NotModified = 304,
     k400BadRequest = 400,
+    k403Forbidden = 403,
     k404NotFound = 404,
+    k405MethodNotAllowed = 405,
+    k413PayloadTooLarge = 413,
+    k416RangeNotSatisfiable = 416,
+    k431RequestHeaderFieldsTooLarge = 431,
+    k500InternalServerError = 500,
+    k503ServiceUnavailable = 503,
   };
 
   explicit HttpResponse(bool close)
     : statusCode_(kUnknown),
-      closeConnection_(close)
+      closeConnection_(close),
+      headersLength_(0),
+      bodyIsRef_(false),
+      chunked_(false)
   {
   }
 
   void setStatusCode(HttpStatusCode code)
   { statusCode_ = code; }
 
+  /// Optional for the codes above, their standard reason phrase is used.
   void setStatusMessage(const string& message)
   { statusMessage_ = message; }
 
@@ -52,25 +89,87 @@ class HttpResponse : public muduo::copyable
   bool closeConnection() const
   { return closeConnection_; }
 
-  void setContentType(const string& contentType)
+  void setContentType(const StringPiece& contentType)
   { addHeader("Content-Type", contentType); }
 
-  // FIXME: replace string with StringPiece
-  void addHeader(const string& key, const string& value)
-  { headers_[key] = value; }
+  /// Headers go out in the order they are added, adding a key twice
+  /// sends it twice.
+  void addHeader(const StringPiece& key, const StringPiece& value);
 
   void setBody(const string& body)
-  { body_ = body; }
+  { body_ = body; bodyIsRef_ = false; }
+  void setBody(string&& body)
+  { body_ = std::move(body); bodyIsRef_ = false; }
+  /// Sends @c body without copying it into the response,
+  /// it must outlive appendToBuffer(), e.g. a static page.
+  void setBodyRef(const StringPiece& body)
+  { bodyRef_ = body; bodyIsRef_ = true; }
+
+  StringPiece body() const
+  { return bodyIsRef_ ? bodyRef_ : StringPiece(body_); }
+
+  /// Body produced by @c cb after headers went out, at the pace the
+  /// peer reads it, with chunked transfer encoding.
+  /// HttpServer sends it as is and closes to HTTP/1.0 clients.
+  void setBodyStream(const StreamCallback& cb)
+  {
+    stream_ = [cb](Buffer* buf, const ResumeCallback&) { return cb(buf); };
+    chunked_ = true;
+  }
+
+  void setBodyStream(const PausableStreamCallback& cb)
+  { stream_ = cb; chunked_ = true; }
+
+  const PausableStreamCallback& bodyStream() const
+  { return stream_; }
 
+  bool chunked() const
+  { return chunked_; }
+  void setChunked(bool on)
+  { chunked_ = on; }
+
+  /// Sends @c length bytes of @c fd from @c offset as body, with sendfile(2).
+  /// The fd is dup(2)ed, caller may close it when this function returns.
+  void setBodyFile(int fd, int64_t offset, size_t length);
+
+  /// Serves file @c path, honors a single "bytes=" range from Range
+  /// header @c range: 200, 206, or 416 with empty body.
+  /// Returns false if it is not a regular file that can be read.
+  bool setBodyFile(const string& path, const StringPiece& range);
+
+  const std::shared_ptr<FileRegion>& bodyFile() const
+  { return file_; }
+
+  /// Body is sent after appendToBuffer(), from bodyStream() or bodyFile().
+  bool streaming() const
+  { return stream_ || file_; }
+
+  /// Status line, headers and body, only headers if streaming().
   void appendToBuffer(Buffer* output) const;
 
+  /// "HTTP/1.1 200 OK\r\n", empty for codes not listed above.
+  static StringPiece statusLine(HttpStatusCode code);
+  /// "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n" of now,
+  /// formatted once per second in each thread.
+  static StringPiece dateHeader();
+
  private:
-  std::map<string, string> headers_;
+  // 常见应答的头部放得下，超出时才用 headersOverflow_。
+  static const size_t kInlineHeaders = 256;
+
   HttpStatusCode statusCode_;
   // FIXME: add http version
   string statusMessage_;
   bool closeConnection_;
+  size_t headersLength_;  // in headers_, or in headersOverflow_ once it's used
+  char headers_[kInlineHeaders];
+  string headersOverflow_;
+  bool bodyIsRef_;
   string body_;
+  StringPiece bodyRef_;
+  bool chunked_;
+  PausableStreamCallback stream_;
+  std::shared_ptr<FileRegion> file_;
 };
 
 }  // namespace net
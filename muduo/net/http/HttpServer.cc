@@ -10,10 +10,14 @@
 #include "muduo/net/http/HttpServer.h"
 
 #include "muduo/base/Logging.h"
+#include "muduo/net/BufferChain.h"
+#include "muduo/net/EventLoop.h"
 #include "muduo/net/http/HttpContext.h"
 #include "muduo/net/http/HttpRequest.h"
 #include "muduo/net/http/HttpResponse.h"
 
+#include <stdio.h>
+
 using namespace muduo;
 using namespace muduo::net;
 
@@ -40,12 +44,19 @@ HttpServer::HttpServer(EventLoop* loop,
                        const string& name,
                        TcpServer::Option option)
   : server_(loop, listenAddr, name, option),
-    httpCallback_(detail::defaultHttpCallback)
+    httpCallback_(detail::defaultHttpCallback),
+    maxBodySize_(HttpContext::kDefaultMaxBodySize),
+    maxPipelineDepth_(16),
+    maxHeaderSize_(HttpContext::kDefaultMaxHeaderSize),
+    zeroCopyRequests_(false),
+    streamHighWaterMark_(64*1024)
 {
   server_.setConnectionCallback(
       std::bind(&HttpServer::onConnection, this, _1));
   server_.setMessageCallback(
       std::bind(&HttpServer::onMessage, this, _1, _2, _3));
+  server_.setWriteCompleteCallback(
+      std::bind(&HttpServer::onWriteComplete, this, _1));
 }
 
 void HttpServer::start()
@@ -59,7 +70,12 @@ void HttpServer::onConnection(const TcpConnectionPtr& conn)
 {
   if (conn->connected())
   {
-    conn->setContext(HttpContext());
+    HttpContext context;
+    context.setMaxHeaderSize(maxHeaderSize_);
+    context.setMaxBodySize(maxBodySize_);
+    context.setBodyCallback(bodyCallback_);
+    context.setZeroCopy(zeroCopyRequests_);
+    conn->setContext(context);
   }
 }
 
@@ -68,33 +84,199 @@ void HttpServer::onMessage(const TcpConnectionPtr& conn,
                            Timestamp receiveTime)
 {
   HttpContext* context = boost::any_cast<HttpContext>(conn->getMutableContext());
+  if (!conn->connected())
+  {
+    // closing, drop what follows
+    buf->retrieveAll();
+    return;
+  }
+  if (context->streamingResponse())
+  {
+    // answered once the body being streamed is sent, reading stops till then
+    return;
+  }
 
-  if (!context->parseRequest(buf, receiveTime))
+  // 流水线上的请求逐个处理，应答攒在一起发送。
+  Buffer& output = output_.value();
+  output.retrieveAll();
+  bool close = false;
+  int handled = 0;
+  while (!close)
+  {
+    if (!context->parseRequest(buf, receiveTime))
+    {
+      if (context->headerTooLarge())
+      {
+        output.append("HTTP/1.1 431 Request Header Fields Too Large\r\n\r\n");
+      }
+      else
+      {
+        output.append(context->bodyTooLarge()
+                      ? "HTTP/1.1 413 Payload Too Large\r\n\r\n"
+                      : "HTTP/1.1 400 Bad Request\r\n\r\n");
+      }
+      close = true;
+    }
+    else if (!context->gotAll())
+    {
+      if (context->needContinue())
+      {
+        output.append("HTTP/1.1 100 Continue\r\n\r\n");
+        context->continueSent();
+      }
+      break;
+    }
+    else
+    {
+      close = onRequest(context, &output);
+      context->reset();
+      if (context->streamingResponse())
+      {
+        break;
+      }
+      if (!close && ++handled >= maxPipelineDepth_ && buf->readableBytes() > 0)
+      {
+        // let other connections run, continue in next iteration
+        conn->getLoop()->queueInLoop(
+            std::bind(&HttpServer::onPendingRequests, this, conn, receiveTime));
+        break;
+      }
+    }
+  }
+
+  if (output.readableBytes() > 0)
+  {
+    conn->send(&output);
+  }
+  if (context->streamingResponse())
+  {
+    // pipelined requests wait in kernel buffer, not in input buffer
+    conn->stopRead();
+    sendStream(conn, context);
+  }
+  else if (close)
   {
-    conn->send("HTTP/1.1 400 Bad Request\r\n\r\n");
+    buf->retrieveAll();
     conn->shutdown();
   }
+}
 
-  if (context->gotAll())
+void HttpServer::onPendingRequests(const TcpConnectionPtr& conn, Timestamp receiveTime)
+{
+  onMessage(conn, conn->inputBuffer(), receiveTime);
+}
+
+void HttpServer::onWriteComplete(const TcpConnectionPtr& conn)
+{
+  HttpContext* context = boost::any_cast<HttpContext>(conn->getMutableContext());
+  if (context && context->streamingResponse() && conn->connected())
   {
-    onRequest(conn, context->request());
-    context->reset();
+    sendStream(conn, context);
   }
 }
 
-void HttpServer::onRequest(const TcpConnectionPtr& conn, const HttpRequest& req)
+bool HttpServer::onRequest(HttpContext* context, Buffer* output)
 {
-  const string& connection = req.getHeader("Connection");
+  const HttpRequest& req = context->request();
+  const StringPiece connection = req.headerView("Connection");
   bool close = connection == "close" ||
     (req.getVersion() == HttpRequest::kHttp10 && connection != "Keep-Alive");
   HttpResponse response(close);
   httpCallback_(req, &response);
-  Buffer buf;
-  response.appendToBuffer(&buf);
-  conn->send(&buf);
-  if (response.closeConnection())
+  if (response.bodyStream() && req.getVersion() == HttpRequest::kHttp10)
   {
-    conn->shutdown();
+    // no chunked encoding in HTTP/1.0, body ends with the connection
+    response.setChunked(false);
+    response.setCloseConnection(true);
+  }
+  response.appendToBuffer(output);
+  if (response.streaming())
+  {
+    context->setStreamingResponse(std::make_shared<HttpResponse>(std::move(response)));
+    return context->streamingResponse()->closeConnection();
   }
+  return response.closeConnection();
 }
 
+// body of the streaming response, headers have been sent
+void HttpServer::sendStream(const TcpConnectionPtr& conn, HttpContext* context)
+{
+  const std::shared_ptr<HttpResponse> response = context->streamingResponse();
+  bool done = true;
+  if (response->bodyFile())
+  {
+    // sendfile(2) paces itself, the region waits in output buffer
+    const FileRegion& file = *response->bodyFile();
+    conn->sendFile(file.fd(), file.offset(), file.length());
+  }
+  else
+  {
+    // 输出缓冲攒到高水位就停，写完后在 onWriteComplete 里继续。
+    Buffer& chunk = output_.value();
+    const HttpResponse::ResumeCallback resume(
+        std::bind(&HttpServer::resumeStream, this, std::weak_ptr<TcpConnection>(conn)));
+    size_t produced = 0;
+    done = false;
+    while (!done && conn->connected()
+           && produced < streamHighWaterMark_
+           && conn->outputBuffer()->readableBytes() < streamHighWaterMark_)
+    {
+      chunk.retrieveAll();
+      done = !response->bodyStream()(&chunk, resume);
+      if (!done && chunk.readableBytes() == 0)
+      {
+        // paused, nothing ready till resumeStream()
+        break;
+      }
+      produced += chunk.readableBytes();
+      if (!response->chunked())
+      {
+        conn->send(&chunk);
+        continue;
+      }
+      char sizeLine[32];
+      std::vector<StringPiece> pieces;
+      if (chunk.readableBytes() > 0)
+      {
+        int n = snprintf(sizeLine, sizeof sizeLine, "%zx\r\n", chunk.readableBytes());
+        pieces.push_back(StringPiece(sizeLine, n));
+        pieces.push_back(StringPiece(chunk.peek(), static_cast<int>(chunk.readableBytes())));
+        pieces.push_back("\r\n");
+      }
+      if (done)
+      {
+        pieces.push_back("0\r\n\r\n");
+      }
+      if (!pieces.empty())
+      {
+        conn->send(pieces);
+      }
+    }
+  }
+
+  if (done)
+  {
+    context->setStreamingResponse(std::shared_ptr<HttpResponse>());
+    conn->startRead();
+    if (response->closeConnection())
+    {
+      conn->inputBuffer()->retrieveAll();
+      conn->shutdown();
+    }
+    else if (conn->inputBuffer()->readableBytes() > 0)
+    {
+      conn->getLoop()->queueInLoop(
+          std::bind(&HttpServer::onPendingRequests, this, conn, conn->lastReceiveTime()));
+    }
+  }
+}
+
+void HttpServer::resumeStream(const std::weak_ptr<TcpConnection>& weakConn)
+{
+  TcpConnectionPtr conn(weakConn.lock());
+  if (conn)
+  {
+    // queued, never reentered from the stream callback
+    conn->getLoop()->queueInLoop(std::bind(&HttpServer::onWriteComplete, this, conn));
+  }
+}
@@ -11,6 +11,7 @@
 #ifndef MUDUO_NET_HTTP_HTTPSERVER_H
 #define MUDUO_NET_HTTP_HTTPSERVER_H
 
+#include "muduo/base/ThreadLocal.h"
 #include "muduo/net/TcpServer.h"
 
 namespace muduo
@@ -18,6 +19,7 @@ namespace muduo
 namespace net
 {
 
+class HttpContext;
 class HttpRequest;
 class HttpResponse;
 
@@ -30,6 +32,9 @@ class HttpServer : noncopyable
  public:
   typedef std::function<void (const HttpRequest&,
                               HttpResponse*)> HttpCallback;
+  /// Body pieces of a request as they arrive, straight from input buffer.
+  typedef std::function<void (HttpRequest*,
+                              const StringPiece&)> BodyCallback;
 
   HttpServer(EventLoop* loop,
              const InetAddress& listenAddr,
@@ -44,11 +49,47 @@ class HttpServer : noncopyable
     httpCallback_ = cb;
   }
 
+  /// Streams request bodies to @c cb, HttpCallback follows once the body
+  /// is complete, with empty body(). Without it, bodies are collected
+  /// into HttpRequest::body().
+  /// Not thread safe, callback be registered before calling start().
+  void setBodyCallback(const BodyCallback& cb)
+  {
+    bodyCallback_ = cb;
+  }
+
+  /// Larger Content-Length, or chunked body, gets 413 and the connection
+  /// closed. Default 1MiB, streamed or not.
+  void setMaxBodySize(size_t bytes)
+  { maxBodySize_ = bytes; }
+
+  /// Parses requests in place, HttpCallback reads them with
+  /// HttpRequest::pathView(), queryView() and headerView().
+  /// Saves a string per header, off by default.
+  void setZeroCopyRequests(bool on)
+  { zeroCopyRequests_ = on; }
+
   void setThreadNum(int numThreads)
   {
     server_.setThreadNum(numThreads);
   }
 
+  /// Pipelined requests answered per batch, their responses go out with
+  /// one send(). The rest wait for the next loop iteration. Default 16.
+  void setMaxPipelineDepth(int depth)
+  { maxPipelineDepth_ = depth; }
+
+  /// Larger request line plus headers gets 431 and the connection closed.
+  /// Default 8KiB.
+  void setMaxHeaderSize(size_t bytes)
+  { maxHeaderSize_ = bytes; }
+
+  /// HttpResponse::bodyStream() is called until this many bytes are
+  /// queued in output buffer, and again once it's drained. Default 64KiB.
+  /// The connection stops reading while a body is streamed.
+  void setStreamHighWaterMark(size_t bytes)
+  { streamHighWaterMark_ = bytes; }
+
   void start();
 
  private:
@@ -56,10 +97,23 @@ class HttpServer : noncopyable
   void onMessage(const TcpConnectionPtr& conn,
                  Buffer* buf,
                  Timestamp receiveTime);
-  void onRequest(const TcpConnectionPtr&, const HttpRequest&);
+  void onPendingRequests(const TcpConnectionPtr& conn, Timestamp receiveTime);
+  void onWriteComplete(const TcpConnectionPtr& conn);
+  // returns true if connection should be closed
+  bool onRequest(HttpContext* context, Buffer* output);
+  void sendStream(const TcpConnectionPtr& conn, HttpContext* context);
+  // HttpResponse::ResumeCallback of a paused stream
+  void resumeStream(const std::weak_ptr<TcpConnection>& weakConn);
 
   TcpServer server_;
   HttpCallback httpCallback_;
+  BodyCallback bodyCallback_;
+  size_t maxBodySize_;
+  int maxPipelineDepth_;
+  size_t maxHeaderSize_;
+  bool zeroCopyRequests_;
+  size_t streamHighWaterMark_;
+  ThreadLocal<Buffer> output_;  // responses of a batch, reused by each loop
 };
 
 }  // namespace net
@@ -0,0 +1,89 @@
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/Buffer.h"
+#include "muduo/net/http/HttpContext.h"
+
+#include <new>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+// ns and allocations per request of HttpContext::parseRequest(),
+// owned strings vs. zero-copy views, for a typical browser GET.
+// Usage: httprequest_bench [requests]
+
+namespace
+{
+int64_t g_allocations = 0;
+
+const char kRequest[] =
+  "GET /static/js/app.min.js?v=20161017 HTTP/1.1\r\n"
+  "Host: www.chenshuo.com\r\n"
+  "Connection: keep-alive\r\n"
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 "
+  "(KHTML, like Gecko) Chrome/54.0.2840.71 Safari/537.36\r\n"
+  "Accept: */*\r\n"
+  "Referer: http://www.chenshuo.com/index.html\r\n"
+  "Accept-Encoding: gzip, deflate, sdch\r\n"
+  "Accept-Language: en-US,en;q=0.8,zh-CN;q=0.6\r\n"
+  "Cookie: session=5f3a9c1e7b2d4a6f; theme=dark\r\n"
+  "\r\n";
+}
+
+void* operator new(size_t size)
+{
+  ++g_allocations;
+  void* p = ::malloc(size);
+  if (p == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  ::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+  ::free(p);
+}
+
+void bench(const char* name, bool zeroCopy, int requests)
+{
+  HttpContext context;
+  context.setZeroCopy(zeroCopy);
+  Buffer input;
+  size_t checksum = 0;
+  const int64_t allocations = g_allocations;
+  Timestamp start(Timestamp::now());
+  for (int i = 0; i < requests; ++i)
+  {
+    input.append(kRequest, sizeof kRequest - 1);
+    if (!context.parseRequest(&input, start) || !context.gotAll())
+    {
+      fprintf(stderr, "parse error\n");
+      abort();
+    }
+    // what HttpServer looks at for every request
+    checksum += context.request().headerView("Connection").size();
+    checksum += context.request().pathView().size();
+    context.reset();
+  }
+  double seconds = timeDifference(Timestamp::now(), start);
+  printf("%-10s %8.1f ns/req %6.2f allocs/req  %zu\n", name,
+         seconds * 1e9 / requests,
+         static_cast<double>(g_allocations - allocations) / requests,
+         checksum);
+}
+
+int main(int argc, char* argv[])
+{
+  const int requests = argc > 1 ? atoi(argv[1]) : 1000 * 1000;
+  bench("owned", false, requests);
+  bench("zero-copy", true, requests);
+}
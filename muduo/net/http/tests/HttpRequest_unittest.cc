@@ -77,3 +77,218 @@ BOOST_AUTO_TEST_CASE(testParseRequestEmptyHeaderValue)
   BOOST_CHECK_EQUAL(request.getHeader("User-Agent"), string(""));
   BOOST_CHECK_EQUAL(request.getHeader("Accept-Encoding"), string(""));
 }
+
+BOOST_AUTO_TEST_CASE(testParseContentLengthBody)
+{
+  HttpContext context;
+  Buffer input;
+  input.append("POST /upload HTTP/1.1\r\n"
+               "content-length: 10\r\n"
+               "\r\n"
+               "01234");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(!context.gotAll());
+  BOOST_CHECK(!context.expectingHeaders());
+
+  input.append("56789GET / HTTP/1.1\r\n\r\n");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.gotAll());
+  BOOST_CHECK_EQUAL(context.request().body(), string("0123456789"));
+  // next pipelined request is left in buffer
+  BOOST_CHECK_EQUAL(input.retrieveAllAsString(), string("GET / HTTP/1.1\r\n\r\n"));
+}
+
+BOOST_AUTO_TEST_CASE(testParseChunkedBodyByteByByte)
+{
+  HttpContext context;
+  const string request = "PUT /data HTTP/1.1\r\n"
+                         "Transfer-Encoding: chunked\r\n"
+                         "Expect: 100-continue\r\n"
+                         "\r\n"
+                         "5;name=value\r\n"
+                         "hello\r\n"
+                         "7\r\n"
+                         ", world\r\n"
+                         "0\r\n"
+                         "Trailer: ignored\r\n"
+                         "\r\n";
+  Buffer input;
+  bool continued = false;
+  for (size_t i = 0; i < request.size(); ++i)
+  {
+    input.append(request.data() + i, 1);
+    BOOST_REQUIRE(context.parseRequest(&input, Timestamp::now()));
+    if (context.needContinue())
+    {
+      continued = true;
+      context.continueSent();
+    }
+    BOOST_CHECK_EQUAL(context.gotAll(), i + 1 == request.size());
+  }
+  BOOST_CHECK(continued);
+  BOOST_CHECK_EQUAL(context.request().body(), string("hello, world"));
+  BOOST_CHECK_EQUAL(input.readableBytes(), 0);
+}
+
+void collectBody(string* pieces, muduo::net::HttpRequest*, const muduo::StringPiece& data)
+{
+  *pieces += "[" + data.as_string() + "]";
+}
+
+BOOST_AUTO_TEST_CASE(testStreamBody)
+{
+  HttpContext context;
+  string pieces;
+  context.setBodyCallback(std::bind(collectBody, &pieces, std::placeholders::_1,
+                                    std::placeholders::_2));
+  Buffer input;
+  input.append("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+               "a\r\n01234");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  input.append("56789\r\n0\r\n\r\n");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.gotAll());
+  BOOST_CHECK_EQUAL(pieces, string("[01234][56789]"));
+  BOOST_CHECK(context.request().body().empty());
+}
+
+BOOST_AUTO_TEST_CASE(testBodyTooLarge)
+{
+  HttpContext context;
+  context.setMaxBodySize(8);
+  Buffer input;
+  input.append("POST / HTTP/1.1\r\nContent-Length: 9\r\n\r\n");
+  BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.bodyTooLarge());
+
+  context.reset();
+  input.retrieveAll();
+  input.append("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n"
+               "5\r\n01234\r\n5\r\n");
+  BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.bodyTooLarge());
+
+  context.reset();
+  input.retrieveAll();
+  input.append("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\nxyz\r\n");
+  BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(!context.bodyTooLarge());
+}
+
+BOOST_AUTO_TEST_CASE(testTrailersTooLarge)
+{
+  // endless trailer line
+  HttpContext context;
+  context.setMaxHeaderSize(128);
+  Buffer input;
+  input.append("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  input.append(string(100, 'x'));
+  BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.headerTooLarge());
+
+  // many complete trailer lines
+  context.reset();
+  input.retrieveAll();
+  input.append("POST / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n");
+  for (int i = 0; i < 10; ++i)
+  {
+    input.append("X-Trailer: 0123456789\r\n");
+  }
+  BOOST_CHECK(!context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.headerTooLarge());
+}
+
+BOOST_AUTO_TEST_CASE(testZeroCopyInTwoPieces)
+{
+  string all("GET /search?q=muduo HTTP/1.1\r\n"
+       "Host: www.chenshuo.com\r\n"
+       "accept-encoding: gzip \r\n"
+       "X-Empty:\r\n"
+       "\r\n");
+
+  for (size_t sz1 = 0; sz1 < all.size(); ++sz1)
+  {
+    HttpContext context;
+    context.setZeroCopy(true);
+    Buffer input;
+    input.append(all.c_str(), sz1);
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(!context.gotAll());
+
+    input.append(all.c_str() + sz1, all.size() - sz1);
+    BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+    BOOST_CHECK(context.gotAll());
+    const HttpRequest& request = context.request();
+    BOOST_CHECK(request.isView());
+    BOOST_CHECK_EQUAL(request.method(), HttpRequest::kGet);
+    BOOST_CHECK_EQUAL(request.pathView().as_string(), string("/search"));
+    BOOST_CHECK_EQUAL(request.queryView().as_string(), string("?q=muduo"));
+    BOOST_CHECK_EQUAL(request.getVersion(), HttpRequest::kHttp11);
+    BOOST_CHECK_EQUAL(request.numHeaderViews(), 3);
+    BOOST_CHECK_EQUAL(request.headerNameView(1).as_string(), string("accept-encoding"));
+    BOOST_CHECK_EQUAL(request.headerView("HOST").as_string(), string("www.chenshuo.com"));
+    BOOST_CHECK_EQUAL(request.headerView("Accept-Encoding").as_string(), string("gzip"));
+    BOOST_CHECK(request.headerView("X-Empty").empty());
+    BOOST_CHECK(request.headerView("X-Empty").data() != NULL);
+    BOOST_CHECK(request.headerView("User-Agent").data() == NULL);
+    BOOST_CHECK(request.headers().empty());
+    BOOST_CHECK_EQUAL(input.readableBytes(), 0u);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testZeroCopyManyHeaders)
+{
+  string all("GET / HTTP/1.0\r\n");
+  for (int i = 0; i < 40; ++i)
+  {
+    all += "X-Header-" + std::to_string(i) + ": " + std::to_string(i * i) + "\r\n";
+  }
+  all += "\r\n";
+
+  HttpContext context;
+  context.setZeroCopy(true);
+  Buffer input;
+  input.append(all);
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.gotAll());
+  const HttpRequest& request = context.request();
+  BOOST_CHECK_EQUAL(request.numHeaderViews(), 40);
+  BOOST_CHECK_EQUAL(request.headerView("x-header-3").as_string(), string("9"));
+  BOOST_CHECK_EQUAL(request.headerView("X-HEADER-39").as_string(), string("1521"));
+  BOOST_CHECK_EQUAL(request.headerValueView(30).as_string(), string("900"));
+  BOOST_CHECK(request.queryView().empty());
+}
+
+BOOST_AUTO_TEST_CASE(testZeroCopyBodyOwnsHeaders)
+{
+  HttpContext context;
+  context.setZeroCopy(true);
+  Buffer input;
+  input.append("POST /upload HTTP/1.1\r\n"
+       "Content-Length: 10\r\n"
+       "\r\n"
+       "01234");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(!context.gotAll());
+
+  // overwrites where the header block was
+  input.retrieveAll();
+  input.append(string(100, 'x'));
+  input.retrieveAll();
+  input.append("56789");
+  BOOST_CHECK(context.parseRequest(&input, Timestamp::now()));
+  BOOST_CHECK(context.gotAll());
+
+  HttpRequest copy(context.request());
+  context.reset();
+  BOOST_CHECK_EQUAL(copy.pathView().as_string(), string("/upload"));
+  BOOST_CHECK_EQUAL(copy.headerView("content-length").as_string(), string("10"));
+  BOOST_CHECK_EQUAL(copy.body(), string("0123456789"));
+
+  HttpRequest swapped;
+  swapped.swap(copy);
+  BOOST_CHECK_EQUAL(swapped.pathView().as_string(), string("/upload"));
+  BOOST_CHECK_EQUAL(swapped.headerView("Content-Length").as_string(), string("10"));
+  BOOST_CHECK(!copy.isView());
+}
@@ -0,0 +1,178 @@
+#include "muduo/net/http/HttpResponse.h"
+#include "muduo/net/Buffer.h"
+#include "muduo/net/BufferChain.h"
+
+//#define BOOST_TEST_MODULE HttpResponseTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+using muduo::string;
+using muduo::StringPiece;
+using muduo::net::Buffer;
+using muduo::net::HttpResponse;
+
+namespace
+{
+int g_allocations = 0;
+}
+
+void* operator new(size_t size)
+{
+  ++g_allocations;
+  void* p = ::malloc(size);
+  if (p == NULL)
+  {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept
+{
+  ::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+  ::free(p);
+}
+
+BOOST_AUTO_TEST_CASE(testSmallResponseDoesNotAllocate)
+{
+  Buffer output;
+  const int before = g_allocations;
+  {
+    HttpResponse response(false);
+    response.setStatusCode(HttpResponse::k200Ok);
+    response.setStatusMessage("OK");
+    response.setContentType("text/plain");
+    response.addHeader("Server", "Muduo");
+    response.setBodyRef("hello, world!\n");
+    response.appendToBuffer(&output);
+  }
+  BOOST_CHECK_EQUAL(g_allocations - before, 0);
+
+  const string expected = string("HTTP/1.1 200 OK\r\n")
+      + HttpResponse::dateHeader().as_string()
+      + "Content-Length: 14\r\n"
+        "Connection: Keep-Alive\r\n"
+        "Content-Type: text/plain\r\n"
+        "Server: Muduo\r\n"
+        "\r\n"
+        "hello, world!\n";
+  BOOST_CHECK_EQUAL(output.retrieveAllAsString(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(testCustomStatusAndManyHeaders)
+{
+  HttpResponse response(true);
+  response.setStatusCode(HttpResponse::k404NotFound);
+  response.setStatusMessage("Nothing Here");
+  string headers;
+  for (int i = 0; i < 20; ++i)
+  {
+    // beyond the inline block
+    const string key = "X-Header-" + std::to_string(i);
+    response.addHeader(key, "value");
+    headers += key + ": value\r\n";
+  }
+  response.setBody(string("gone"));
+  HttpResponse copy(response);
+
+  Buffer output;
+  copy.appendToBuffer(&output);
+  const string expected = string("HTTP/1.1 404 Nothing Here\r\n")
+      + HttpResponse::dateHeader().as_string()
+      + "Connection: close\r\n"
+      + headers
+      + "\r\n"
+        "gone";
+  BOOST_CHECK_EQUAL(output.retrieveAllAsString(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(testStatusLines)
+{
+  BOOST_CHECK_EQUAL(HttpResponse::statusLine(HttpResponse::k206PartialContent).as_string(),
+                    "HTTP/1.1 206 Partial Content\r\n");
+  BOOST_CHECK(HttpResponse::statusLine(HttpResponse::kUnknown).empty());
+  const StringPiece date = HttpResponse::dateHeader();
+  BOOST_CHECK(date.starts_with("Date: "));
+  BOOST_CHECK_EQUAL(date.size(), strlen("Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"));
+}
+
+BOOST_AUTO_TEST_CASE(testStreamingHeaders)
+{
+  HttpResponse response(false);
+  response.setStatusCode(HttpResponse::k200Ok);
+  response.setBodyStream([](Buffer*) { return false; });
+  BOOST_CHECK(response.streaming());
+
+  Buffer output;
+  response.appendToBuffer(&output);
+  const string expected = string("HTTP/1.1 200 OK\r\n")
+      + HttpResponse::dateHeader().as_string()
+      + "Transfer-Encoding: chunked\r\n"
+        "Connection: Keep-Alive\r\n"
+        "\r\n";
+  BOOST_CHECK_EQUAL(output.retrieveAllAsString(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(testFileRanges)
+{
+  char path[] = "/tmp/httpresponse_unittest_XXXXXX";
+  int fd = ::mkstemp(path);
+  BOOST_REQUIRE_GE(fd, 0);
+  BOOST_REQUIRE_EQUAL(::write(fd, "0123456789", 10), 10);
+  ::close(fd);
+  const struct
+  {
+    const char* range;
+    HttpResponse::HttpStatusCode code;
+    int64_t offset;
+    size_t length;
+  } cases[] =
+  {
+    { "", HttpResponse::k200Ok, 0, 10 },
+    { "bytes=2-5", HttpResponse::k206PartialContent, 2, 4 },
+    { "bytes=7-", HttpResponse::k206PartialContent, 7, 3 },
+    { "bytes=-3", HttpResponse::k206PartialContent, 7, 3 },
+    { "bytes=-30", HttpResponse::k206PartialContent, 0, 10 },
+    { "bytes=8-100", HttpResponse::k206PartialContent, 8, 2 },
+    { "bytes=0-1,4-5", HttpResponse::k200Ok, 0, 10 },
+    { "bytes=5-2", HttpResponse::k200Ok, 0, 10 },
+    { "items=0-1", HttpResponse::k200Ok, 0, 10 },
+  };
+  for (const auto& c : cases)
+  {
+    HttpResponse response(false);
+    BOOST_REQUIRE(response.setBodyFile(path, c.range));
+    Buffer output;
+    response.appendToBuffer(&output);
+    const string message = output.retrieveAllAsString();
+    BOOST_CHECK_EQUAL(message.find(HttpResponse::statusLine(c.code).as_string()), 0u);
+    BOOST_REQUIRE(response.bodyFile());
+    BOOST_CHECK_EQUAL(response.bodyFile()->offset(), c.offset);
+    BOOST_CHECK_EQUAL(response.bodyFile()->length(), c.length);
+    BOOST_CHECK_NE(message.find("Content-Length: " + std::to_string(c.length) + "\r\n"),
+                   string::npos);
+  }
+
+  HttpResponse unsatisfiable(false);
+  BOOST_REQUIRE(unsatisfiable.setBodyFile(path, "bytes=10-"));
+  BOOST_CHECK(!unsatisfiable.streaming());
+  Buffer output;
+  unsatisfiable.appendToBuffer(&output);
+  const string message = output.retrieveAllAsString();
+  BOOST_CHECK_EQUAL(message.find("HTTP/1.1 416 Range Not Satisfiable\r\n"), 0u);
+  BOOST_CHECK_NE(message.find("Content-Range: bytes */10\r\n"), string::npos);
+  BOOST_CHECK_NE(message.find("Content-Length: 0\r\n"), string::npos);
+
+  ::unlink(path);
+  HttpResponse missing(false);
+  BOOST_CHECK(!missing.setBodyFile(path, ""));
+  BOOST_CHECK(!missing.setBodyFile("/tmp", ""));
+}
@@ -14,6 +14,7 @@
 #include "muduo/net/EventLoop.h"
 #include "muduo/net/http/HttpRequest.h"
 #include "muduo/net/http/HttpResponse.h"
+#include "muduo/net/inspect/LoopInspector.h"
 #include "muduo/net/inspect/ProcessInspector.h"
 #include "muduo/net/inspect/PerformanceInspector.h"
 #include "muduo/net/inspect/SystemInspector.h"
@@ -63,6 +64,7 @@ Inspector::Inspector(EventLoop* loop,
                      const InetAddress& httpAddr,
                      const string& name)
     : server_(loop, httpAddr, "Inspector:"+name),
+      loopInspector_(new LoopInspector),
       processInspector_(new ProcessInspector),
       systemInspector_(new SystemInspector)
 {
@@ -70,6 +72,7 @@ Inspector::Inspector(EventLoop* loop,
   assert(g_globalInspector == 0);
   g_globalInspector = this;
   server_.setHttpCallback(std::bind(&Inspector::onRequest, this, _1, _2));
+  loopInspector_->registerCommands(this);
   processInspector_->registerCommands(this);
   systemInspector_->registerCommands(this);
 #ifdef HAVE_TCMALLOC
@@ -106,6 +109,11 @@ void Inspector::remove(const string& module, const string& command)
   }
 }
 
+void Inspector::addEventLoops(const std::vector<EventLoop*>& loops)
+{
+  loopInspector_->addEventLoops(loops);
+}
+
 void Inspector::start()
 {
   server_.start();
@@ -137,7 +145,7 @@ void Inspector::onRequest(const HttpRequest& req, HttpResponse* resp)
     resp->setStatusCode(HttpResponse::k200Ok);
     resp->setStatusMessage("OK");
     resp->setContentType("text/plain");
-    resp->setBody(result);
+    resp->setBody(std::move(result));
   }
   else
   {
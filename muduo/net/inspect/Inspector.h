@@ -22,6 +22,7 @@ namespace muduo
 namespace net
 {
 
+class LoopInspector;
 class ProcessInspector;
 class PerformanceInspector;
 class SystemInspector;
@@ -45,6 +46,11 @@ class Inspector : noncopyable
            const string& help);
   void remove(const string& module, const string& command);
 
+  /// Add EventLoops to be shown in /loop/ pages,
+  /// e.g. TcpServer::threadPool()->getAllLoops().
+  /// Thread safe.
+  void addEventLoops(const std::vector<EventLoop*>& loops);
+
  private:
   typedef std::map<string, Callback> CommandList;
   typedef std::map<string, string> HelpList;
@@ -53,6 +59,7 @@ class Inspector : noncopyable
   void onRequest(const HttpRequest& req, HttpResponse* resp);
 
   HttpServer server_;
+  std::unique_ptr<LoopInspector> loopInspector_;
   std::unique_ptr<ProcessInspector> processInspector_;
   std::unique_ptr<PerformanceInspector> performanceInspector_;
   std::unique_ptr<SystemInspector> systemInspector_;
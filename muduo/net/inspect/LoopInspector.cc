@@ -0,0 +1,190 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+
+#include "muduo/net/inspect/LoopInspector.h"
+
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/net/BufferPool.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpConnection.h"
+
+#include <algorithm>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+
+template<typename T>
+void runAndCountDown(const std::function<T (EventLoop*)>& func,
+                     EventLoop* loop,
+                     T* result,
+                     CountDownLatch* latch)
+{
+  *result = func(loop);
+  latch->countDown();
+}
+
+string bufferPoolStats(EventLoop* loop)
+{
+  return loop->bufferPool()->toString();
+}
+
+// copied in loop thread, as counters of TcpConnection are not atomic
+struct ConnectionStats
+{
+  string name;
+  string peer;
+  Timestamp creationTime;
+  Timestamp lastReceiveTime;
+  int64_t bytesReceived;
+  int64_t bytesSent;
+  int64_t readCalls;
+  int64_t writeCalls;
+  int64_t writesSaved;
+  size_t outputBytes;
+  size_t outputHighWaterMark;
+};
+
+std::vector<ConnectionStats> connectionStats(EventLoop* loop)
+{
+  std::vector<ConnectionStats> result;
+  result.reserve(loop->establishedConnections().size());
+  for (TcpConnection* conn : loop->establishedConnections())
+  {
+    ConnectionStats stats;
+    stats.name = conn->name();
+    stats.peer = conn->peerAddress().toIpPort();
+    stats.creationTime = conn->creationTime();
+    stats.lastReceiveTime = conn->lastReceiveTime();
+    stats.bytesReceived = conn->bytesReceived();
+    stats.bytesSent = conn->bytesSent();
+    stats.readCalls = conn->readCalls();
+    stats.writeCalls = conn->writeCalls();
+    stats.writesSaved = conn->writesSaved();
+    stats.outputBytes = conn->outputBuffer()->readableBytes();
+    stats.outputHighWaterMark = conn->outputHighWaterMark();
+    result.push_back(stats);
+  }
+  return result;
+}
+
+// worst write backlog first
+bool backlogGreater(const std::pair<size_t, ConnectionStats>& lhs,
+                    const std::pair<size_t, ConnectionStats>& rhs)
+{
+  if (lhs.second.outputHighWaterMark != rhs.second.outputHighWaterMark)
+  {
+    return lhs.second.outputHighWaterMark > rhs.second.outputHighWaterMark;
+  }
+  return lhs.second.outputBytes > rhs.second.outputBytes;
+}
+
+}  // namespace
+
+void LoopInspector::registerCommands(Inspector* ins)
+{
+  ins->add("loop", "bufferpool",
+           std::bind(&LoopInspector::bufferPool, this, _1, _2),
+           "print BufferPool hits/misses of each loop");
+  ins->add("loop", "connections",
+           std::bind(&LoopInspector::connections, this, _1, _2),
+           "print traffic counters of connections, largest output backlog first");
+}
+
+void LoopInspector::addEventLoops(const std::vector<EventLoop*>& loops)
+{
+  MutexLockGuard lock(mutex_);
+  for (EventLoop* loop : loops)
+  {
+    if (std::find(loops_.begin(), loops_.end(), loop) == loops_.end())
+    {
+      loops_.push_back(loop);
+    }
+  }
+}
+
+template<typename T>
+std::vector<T> LoopInspector::collect(const std::function<T (EventLoop*)>& func)
+{
+  std::vector<EventLoop*> loops;
+  {
+  MutexLockGuard lock(mutex_);
+  loops = loops_;
+  }
+
+  std::vector<T> results(loops.size());
+  CountDownLatch latch(static_cast<int>(loops.size()));
+  for (size_t i = 0; i < loops.size(); ++i)
+  {
+    loops[i]->runInLoop(std::bind(runAndCountDown<T>, std::cref(func),
+                                  loops[i], &results[i], &latch));
+  }
+  latch.wait();
+  return results;
+}
+
+string LoopInspector::bufferPool(HttpRequest::Method, const Inspector::ArgList&)
+{
+  std::vector<string> stats = collect<string>(bufferPoolStats);
+  string result;
+  char buf[64];
+  for (size_t i = 0; i < stats.size(); ++i)
+  {
+    snprintf(buf, sizeof buf, "loop %zd: ", i);
+    result += buf;
+    result += stats[i];
+  }
+  return result;
+}
+
+string LoopInspector::connections(HttpRequest::Method, const Inspector::ArgList&)
+{
+  std::vector<std::vector<ConnectionStats>> stats =
+      collect<std::vector<ConnectionStats>>(connectionStats);
+  std::vector<std::pair<size_t, ConnectionStats>> all;
+  for (size_t i = 0; i < stats.size(); ++i)
+  {
+    for (const ConnectionStats& conn : stats[i])
+    {
+      all.push_back(std::make_pair(i, conn));
+    }
+  }
+  std::sort(all.begin(), all.end(), backlogGreater);
+
+  const Timestamp now = Timestamp::now();
+  string result;
+  char buf[512];
+  snprintf(buf, sizeof buf, "%zd connections\n"
+           "loop %-32s %-21s %8s %8s %12s %12s %8s %8s %8s %10s %10s\n",
+           all.size(), "name", "peer", "age", "idle", "bytes_in", "bytes_out",
+           "reads", "writes", "saved", "out_queue", "out_max");
+  result += buf;
+  for (const auto& entry : all)
+  {
+    const ConnectionStats& conn = entry.second;
+    const double idle = conn.lastReceiveTime.valid()
+        ? timeDifference(now, conn.lastReceiveTime)
+        : timeDifference(now, conn.creationTime);
+    snprintf(buf, sizeof buf,
+             "%4zd %-32s %-21s %8.1f %8.1f %12" PRId64 " %12" PRId64
+             " %8" PRId64 " %8" PRId64 " %8" PRId64 " %10zd %10zd\n",
+             entry.first, conn.name.c_str(), conn.peer.c_str(),
+             timeDifference(now, conn.creationTime), idle,
+             conn.bytesReceived, conn.bytesSent,
+             conn.readCalls, conn.writeCalls, conn.writesSaved,
+             conn.outputBytes, conn.outputHighWaterMark);
+    result += buf;
+  }
+  return result;
+}
@@ -0,0 +1,44 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is an internal header file, you should not include this.
+
+#ifndef MUDUO_NET_INSPECT_LOOPINSPECTOR_H
+#define MUDUO_NET_INSPECT_LOOPINSPECTOR_H
+
+#include "muduo/net/inspect/Inspector.h"
+
+namespace muduo
+{
+namespace net
+{
+
+// Statistics of EventLoops, collected in each loop thread on demand.
+class LoopInspector : noncopyable
+{
+ public:
+  void registerCommands(Inspector* ins);
+
+  void addEventLoops(const std::vector<EventLoop*>& loops);
+
+  string bufferPool(HttpRequest::Method, const Inspector::ArgList&);
+  string connections(HttpRequest::Method, const Inspector::ArgList&);
+
+ private:
+  // runs func in each loop thread, and waits for the results.
+  template<typename T>
+  std::vector<T> collect(const std::function<T (EventLoop*)>& func);
+
+  MutexLock mutex_;
+  std::vector<EventLoop*> loops_ GUARDED_BY(mutex_);
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_INSPECT_LOOPINSPECTOR_H
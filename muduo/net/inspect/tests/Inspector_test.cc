@@ -9,7 +9,12 @@ int main()
 {
   EventLoop loop;
   EventLoopThread t;
-  Inspector ins(t.startLoop(), InetAddress(12345), "test");
+  EventLoop* inspectorLoop = t.startLoop();
+  Inspector ins(inspectorLoop, InetAddress(12345), "test");
+  std::vector<EventLoop*> loops;
+  loops.push_back(&loop);
+  loops.push_back(inspectorLoop);  // shows its own connections in /loop/connections
+  ins.addEventLoops(loops);
   loop.loop();
 }
 
@@ -9,6 +9,9 @@
 #include "muduo/net/Poller.h"
 #include "muduo/net/poller/PollPoller.h"
 #include "muduo/net/poller/EPollPoller.h"
+#ifdef MUDUO_HAVE_IO_URING
+#include "muduo/net/poller/IoUringPoller.h"
+#endif
 
 #include <stdlib.h>
 
@@ -22,6 +25,12 @@ Poller* Poller::newDefaultPoller(EventLoop* loop)
   {
     return new PollPoller(loop);
   }
+#ifdef MUDUO_HAVE_IO_URING
+  else if (::getenv("MUDUO_USE_IO_URING") && IoUringPoller::isSupported())
+  {
+    return new IoUringPoller(loop);
+  }
+#endif
   else
   {
     return new EPollPoller(loop);
@@ -166,6 +166,11 @@ void EPollPoller::update(int operation, Channel* channel)
   struct epoll_event event;           // 需要准备一个event结构体。
   memZero(&event, sizeof event);
   event.events = channel->events();
+  if (channel->isEdgeTriggered())
+  {
+    // write interest stays registered, see Channel::update()
+    event.events |= EPOLLOUT | EPOLLET;
+  }
   event.data.ptr = channel;
   int fd = channel->fd();
   LOG_TRACE << "epoll_ctl op = " << operationToString(operation)
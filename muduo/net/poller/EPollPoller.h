@@ -34,6 +34,7 @@ class EPollPoller : public Poller
   Timestamp poll(int timeoutMs, ChannelList* activeChannels) override;
   void updateChannel(Channel* channel) override;
   void removeChannel(Channel* channel) override;
+  bool supportsEdgeTriggered() const override { return true; }
 
  private:
   static const int kInitEventListSize = 16;             // 初始能够容纳的空间为16.
@@ -0,0 +1,668 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/poller/IoUringPoller.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/Channel.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+const int kNew = -1;
+const int kAdded = 1;
+
+// user_data of a request is (generation << 32 | kind << 30 | fd), a
+// completion is matched against fds_ and ignored if stale, so a Channel
+// pointer is never dereferenced after it has gone.
+const int kKindShift = 30;
+const uint64_t kFdMask = (uint64_t(1) << kKindShift) - 1;
+const uint16_t kBufferGroup = 0;
+
+int kindOf(uint64_t userData)
+{
+  return static_cast<int>((userData >> kKindShift) & 3);
+}
+
+int fdOf(uint64_t userData)
+{
+  return static_cast<int>(userData & kFdMask);
+}
+
+int setup(unsigned entries, struct io_uring_params* params)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+void* mapRing(int ringFd, size_t size, off_t offset)
+{
+  void* ptr = ::mmap(NULL, size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ringFd, offset);
+  if (ptr == MAP_FAILED)
+  {
+    LOG_SYSFATAL << "IoUringPoller mmap";
+  }
+  return ptr;
+}
+
+template<typename T>
+T* ringField(void* ring, uint32_t offset)
+{
+  return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+}  // namespace
+
+bool IoUringPoller::isSupported()
+{
+  struct io_uring_params params;
+  memZero(&params, sizeof params);
+  int fd = setup(1, &params);
+  if (fd < 0)
+  {
+    return false;
+  }
+  ::close(fd);
+  return (params.features & IORING_FEAT_EXT_ARG) != 0;
+}
+
+IoUringPoller::IoUringPoller(EventLoop* loop)
+  : Poller(loop),
+    ringFd_(-1),
+    sqPending_(0),
+    nextGeneration_(1),
+    readRing_(NULL),
+    readBase_(NULL),
+    writeBase_(NULL)
+{
+  struct io_uring_params params;
+  memZero(&params, sizeof params);
+  ringFd_ = setup(kRingEntries, &params);
+  if (ringFd_ < 0)
+  {
+    LOG_SYSFATAL << "IoUringPoller::IoUringPoller";
+  }
+  if (!(params.features & IORING_FEAT_EXT_ARG))
+  {
+    LOG_FATAL << "IoUringPoller::IoUringPoller - kernel lacks IORING_FEAT_EXT_ARG";
+  }
+  ::fcntl(ringFd_, F_SETFD, FD_CLOEXEC);
+
+  sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+  {
+    sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+  }
+  sqRing_ = mapRing(ringFd_, sqRingSize_, IORING_OFF_SQ_RING);
+  cqRing_ = (params.features & IORING_FEAT_SINGLE_MMAP)
+      ? sqRing_ : mapRing(ringFd_, cqRingSize_, IORING_OFF_CQ_RING);
+  sqesSize_ = params.sq_entries * sizeof(struct io_uring_sqe);
+  sqes_ = static_cast<struct io_uring_sqe*>(mapRing(ringFd_, sqesSize_, IORING_OFF_SQES));
+
+  sqHead_ = ringField<unsigned>(sqRing_, params.sq_off.head);
+  sqTail_ = ringField<unsigned>(sqRing_, params.sq_off.tail);
+  sqMask_ = *ringField<unsigned>(sqRing_, params.sq_off.ring_mask);
+  sqArray_ = ringField<unsigned>(sqRing_, params.sq_off.array);
+  cqHead_ = ringField<unsigned>(cqRing_, params.cq_off.head);
+  cqTail_ = ringField<unsigned>(cqRing_, params.cq_off.tail);
+  cqMask_ = *ringField<unsigned>(cqRing_, params.cq_off.ring_mask);
+  cqes_ = ringField<struct io_uring_cqe>(cqRing_, params.cq_off.cqes);
+  initFixedBuffers();
+}
+
+void IoUringPoller::initFixedBuffers()
+{
+  memZero(writeOwners_, sizeof writeOwners_);
+  // buffer ring for reads, the kernel picks a buffer when data arrives
+  const size_t ringSize = kReadBuffers * sizeof(struct io_uring_buf);
+  void* ring = ::mmap(NULL, ringSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  void* base = ::mmap(NULL, kReadBuffers * kReadBufferSize, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ring != MAP_FAILED)
+  {
+    // fault the page in, or the kernel may pin the shared zero page
+    memZero(ring, ringSize);
+  }
+  struct io_uring_buf_reg reg;
+  memZero(&reg, sizeof reg);
+  reg.ring_addr = reinterpret_cast<uintptr_t>(ring);
+  reg.ring_entries = kReadBuffers;
+  reg.bgid = kBufferGroup;
+  if (ring != MAP_FAILED && base != MAP_FAILED
+      && registerRing(IORING_REGISTER_PBUF_RING, &reg, 1) == 0)
+  {
+    readRing_ = static_cast<struct io_uring_buf_ring*>(ring);
+    readBase_ = static_cast<char*>(base);
+    for (unsigned i = 0; i < kReadBuffers; ++i)
+    {
+      recycleReadBuffer(static_cast<int>(i));
+    }
+  }
+  else
+  {
+    LOG_SYSERR << "IoUringPoller - no registered buffer ring, reads are polled";
+    if (ring != MAP_FAILED)
+    {
+      ::munmap(ring, ringSize);
+    }
+    if (base != MAP_FAILED)
+    {
+      ::munmap(base, kReadBuffers * kReadBufferSize);
+    }
+  }
+
+  // registered buffers for writes, pinned by the kernel
+  base = ::mmap(NULL, kWriteBuffers * kWriteBufferSize, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  struct iovec vec[kWriteBuffers];
+  for (int i = 0; i < kWriteBuffers; ++i)
+  {
+    vec[i].iov_base = static_cast<char*>(base) + i * kWriteBufferSize;
+    vec[i].iov_len = kWriteBufferSize;
+  }
+  if (base != MAP_FAILED && registerRing(IORING_REGISTER_BUFFERS, vec, kWriteBuffers) == 0)
+  {
+    writeBase_ = static_cast<char*>(base);
+  }
+  else
+  {
+    // e.g. over RLIMIT_MEMLOCK
+    LOG_SYSERR << "IoUringPoller - no registered buffers, writes are polled";
+    if (base != MAP_FAILED)
+    {
+      ::munmap(base, kWriteBuffers * kWriteBufferSize);
+    }
+  }
+}
+
+IoUringPoller::~IoUringPoller()
+{
+  ::munmap(sqes_, sqesSize_);
+  if (cqRing_ != sqRing_)
+  {
+    ::munmap(cqRing_, cqRingSize_);
+  }
+  ::munmap(sqRing_, sqRingSize_);
+  // cancels requests in flight, before their buffers go
+  ::close(ringFd_);
+  if (readRing_)
+  {
+    ::munmap(readRing_, kReadBuffers * sizeof(struct io_uring_buf));
+    ::munmap(readBase_, kReadBuffers * kReadBufferSize);
+  }
+  if (writeBase_)
+  {
+    ::munmap(writeBase_, kWriteBuffers * kWriteBufferSize);
+  }
+}
+
+Timestamp IoUringPoller::poll(int timeoutMs, ChannelList* activeChannels)
+{
+  LOG_TRACE << "fd total count " << channels_.size();
+  // channels have taken data of reads delivered last time
+  for (int buffer : delivered_)
+  {
+    recycleReadBuffer(buffer);
+  }
+  delivered_.clear();
+
+  // (re)arm changed channels, and those fired last time, they may still
+  // be readable/writable
+  for (size_t i = 0; i < dirty_.size(); ++i)
+  {
+    const int fd = dirty_[i];
+    std::map<int, FdState>::iterator state = fds_.find(fd);
+    if (state != fds_.end() && state->second.dirty)
+    {
+      state->second.dirty = false;
+      arm(channels_[fd], &state->second);
+    }
+  }
+  dirty_.clear();
+
+  const bool ready = !ready_.empty()
+      || __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE) != *cqHead_;
+  int ret = enter(sqPending_, (ready || timeoutMs == 0) ? 0 : 1, true, timeoutMs);
+  int savedErrno = errno;
+  Timestamp now(Timestamp::now());
+  if (ret >= 0)
+  {
+    sqPending_ -= ret;
+  }
+  else if (savedErrno != EINTR && savedErrno != ETIME && savedErrno != EBUSY)
+  {
+    errno = savedErrno;
+    LOG_SYSERR << "IoUringPoller::poll()";
+  }
+  fillActiveChannels(activeChannels);
+  if (activeChannels->empty())
+  {
+    LOG_TRACE << "nothing happened";
+  }
+  else
+  {
+    LOG_TRACE << activeChannels->size() << " events happened";
+  }
+  return now;
+}
+
+void IoUringPoller::fillActiveChannels(ChannelList* activeChannels)
+{
+  for (int fd : ready_)
+  {
+    std::map<int, FdState>::iterator state = fds_.find(fd);
+    if (state != fds_.end() && state->second.stashed)
+    {
+      FdState& st = state->second;
+      st.stashed = false;
+      deliverRead(fd, &st, st.stashedBuffer, st.stashedResult);
+    }
+  }
+  ready_.clear();
+
+  unsigned head = *cqHead_;
+  const unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+  for (; head != tail; ++head)
+  {
+    const struct io_uring_cqe& cqe = cqes_[head & cqMask_];
+    const uint64_t userData = cqe.user_data;
+    const int kind = kindOf(userData);
+    const int fd = fdOf(userData);
+    if (kind == kCancelOp)
+    {
+      continue;
+    }
+    std::map<int, FdState>::iterator state = fds_.find(fd);
+    FdState* st = state != fds_.end() ? &state->second : NULL;
+    if (kind == kPollOp)
+    {
+      if (st == NULL || st->poll != userData)
+      {
+        continue;  // stale, cancelled or re-armed since
+      }
+      st->poll = 0;
+      st->pollEvents = 0;
+      markDirty(fd, st);
+      if (cqe.res < 0)
+      {
+        errno = -cqe.res;
+        LOG_SYSERR << "IoUringPoller poll fd = " << fd;
+      }
+      if (st->revents == 0)
+      {
+        active_.push_back(fd);
+      }
+      st->revents |= cqe.res < 0 ? POLLERR : cqe.res;
+    }
+    else if (kind == kReadOp)
+    {
+      const int buffer = (cqe.flags & IORING_CQE_F_BUFFER)
+          ? static_cast<int>(cqe.flags >> IORING_CQE_BUFFER_SHIFT) : -1;
+      if (st == NULL || st->read != userData)
+      {
+        // channel removed
+        if (buffer >= 0)
+        {
+          recycleReadBuffer(buffer);
+        }
+        continue;
+      }
+      st->read = 0;
+      markDirty(fd, st);
+      if (cqe.res == -ENOBUFS)
+      {
+        st->readFallback = true;
+      }
+      else if (!channels_[fd]->isReading())
+      {
+        // e.g. TcpConnection::stopRead(), keep it till reading again
+        st->stashed = true;
+        st->stashedBuffer = buffer;
+        st->stashedResult = cqe.res;
+      }
+      else
+      {
+        deliverRead(fd, st, buffer, cqe.res);
+      }
+    }
+    else
+    {
+      assert(kind == kWriteOp);
+      for (int i = 0; i < kWriteBuffers; ++i)
+      {
+        if (writeOwners_[i] == userData)
+        {
+          writeOwners_[i] = 0;
+          break;
+        }
+      }
+      if (st == NULL || st->write != userData)
+      {
+        continue;
+      }
+      st->write = 0;
+      markDirty(fd, st);
+      if (st->revents == 0)
+      {
+        active_.push_back(fd);
+      }
+      st->revents |= POLLOUT;
+      channels_[fd]->setFixedWriteResult(cqe.res);
+    }
+  }
+  __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+
+  for (int fd : active_)
+  {
+    FdState& st = fds_[fd];
+    Channel* channel = channels_[fd];
+    channel->set_revents(st.revents);
+    st.revents = 0;
+    activeChannels->push_back(channel);
+  }
+  active_.clear();
+}
+
+void IoUringPoller::deliverRead(int fd, FdState* state, int buffer, int result)
+{
+  const char* data = NULL;
+  if (buffer >= 0)
+  {
+    data = readBase_ + buffer * kReadBufferSize;
+    delivered_.push_back(buffer);
+  }
+  channels_[fd]->setFixedReadResult(data, result);
+  if (state->revents == 0)
+  {
+    active_.push_back(fd);
+  }
+  state->revents |= POLLIN;
+}
+
+void IoUringPoller::recycleReadBuffer(int buffer)
+{
+  const uint16_t tail = readRing_->tail;
+  // not readRing_->bufs, it is off by one byte when the uapi header is
+  // compiled as C++, tail overlays resv of the first entry
+  struct io_uring_buf* bufs = reinterpret_cast<struct io_uring_buf*>(readRing_);
+  struct io_uring_buf& buf = bufs[tail & (kReadBuffers - 1)];
+  buf.addr = reinterpret_cast<uintptr_t>(readBase_ + buffer * kReadBufferSize);
+  buf.len = static_cast<uint32_t>(kReadBufferSize);
+  buf.bid = static_cast<uint16_t>(buffer);
+  __atomic_store_n(&readRing_->tail, static_cast<uint16_t>(tail + 1), __ATOMIC_RELEASE);
+}
+
+void IoUringPoller::updateChannel(Channel* channel)
+{
+  Poller::assertInLoopThread();
+  const int fd = channel->fd();
+  LOG_TRACE << "fd = " << fd
+    << " events = " << channel->events() << " index = " << channel->index();
+  if (channel->index() == kNew)
+  {
+    assert(channels_.find(fd) == channels_.end());
+    assert(fds_.find(fd) == fds_.end());
+    channels_[fd] = channel;
+    channel->set_index(kAdded);
+    FdState& state = fds_[fd];
+    memZero(&state, sizeof state);
+    state.stashedBuffer = -1;
+    markDirty(fd, &state);
+  }
+  else
+  {
+    assert(channels_.find(fd) != channels_.end());
+    assert(channels_[fd] == channel);
+    markDirty(fd, &fds_[fd]);
+  }
+}
+
+void IoUringPoller::removeChannel(Channel* channel)
+{
+  Poller::assertInLoopThread();
+  int fd = channel->fd();
+  LOG_TRACE << "fd = " << fd;
+  assert(channels_.find(fd) != channels_.end());
+  assert(channels_[fd] == channel);
+  assert(channel->isNoneEvent());
+  assert(channel->index() == kAdded);
+  size_t n = channels_.erase(fd);
+  (void)n;
+  assert(n == 1);
+  std::map<int, FdState>::iterator state = fds_.find(fd);
+  assert(state != fds_.end());
+  FdState& st = state->second;
+  if (st.poll || st.read)
+  {
+    if (st.poll)
+    {
+      cancel(st.poll, true);
+    }
+    if (st.read)
+    {
+      cancel(st.read, false);
+    }
+    // requests hold the file, let it go before owner closes fd,
+    // e.g. so a listening port can be bound again
+    submit();
+  }
+  // a write in flight can't be taken back, its buffer is freed on completion
+  if (st.stashed && st.stashedBuffer >= 0)
+  {
+    recycleReadBuffer(st.stashedBuffer);
+  }
+  fds_.erase(state);
+  channel->set_index(kNew);
+}
+
+void IoUringPoller::markDirty(int fd, FdState* state)
+{
+  if (!state->dirty)
+  {
+    state->dirty = true;
+    dirty_.push_back(fd);
+  }
+}
+
+void IoUringPoller::arm(Channel* channel, FdState* state)
+{
+  const int fd = channel->fd();
+  const int events = channel->events();
+  int pollEvents = events;
+  if (channel->fixedBufferIo())
+  {
+    if ((events & POLLIN) && readRing_ && !state->readFallback)
+    {
+      if (state->read == 0 && !state->stashed)
+      {
+        submitRead(fd, state);
+      }
+      pollEvents &= ~(POLLIN | POLLPRI);
+    }
+    if ((events & POLLOUT) && writeBase_)
+    {
+      if (state->write == 0)
+      {
+        submitWrite(channel, state);
+      }
+      if (state->write != 0)
+      {
+        pollEvents &= ~POLLOUT;
+      }
+    }
+  }
+  state->readFallback = false;
+  if (state->stashed && (events & POLLIN))
+  {
+    ready_.push_back(fd);
+  }
+
+  if (state->poll != 0 && state->pollEvents != pollEvents)
+  {
+    cancel(state->poll, true);
+    state->poll = 0;
+  }
+  if (state->poll == 0 && pollEvents != 0)
+  {
+    submitPoll(fd, state, pollEvents);
+  }
+}
+
+uint64_t IoUringPoller::makeUserData(OpKind kind, int fd)
+{
+  const uint32_t generation = nextGeneration_++;
+  if (nextGeneration_ == 0)
+  {
+    nextGeneration_ = 1;
+  }
+  assert(static_cast<uint64_t>(fd) <= kFdMask);
+  return (static_cast<uint64_t>(generation) << 32)
+      | (static_cast<uint64_t>(kind) << kKindShift)
+      | static_cast<uint32_t>(fd);
+}
+
+void IoUringPoller::submitPoll(int fd, FdState* state, int events)
+{
+  state->poll = makeUserData(kPollOp, fd);
+  state->pollEvents = events;
+  struct io_uring_sqe* sqe = getSqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = fd;
+  sqe->poll32_events = static_cast<uint32_t>(events);
+  sqe->user_data = state->poll;
+}
+
+void IoUringPoller::submitRead(int fd, FdState* state)
+{
+  state->read = makeUserData(kReadOp, fd);
+  struct io_uring_sqe* sqe = getSqe();
+  sqe->opcode = IORING_OP_RECV;
+  sqe->fd = fd;
+  sqe->len = static_cast<uint32_t>(kReadBufferSize);
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = kBufferGroup;
+  sqe->user_data = state->read;
+}
+
+void IoUringPoller::submitWrite(Channel* channel, FdState* state)
+{
+  int buffer = 0;
+  while (buffer < kWriteBuffers && writeOwners_[buffer] != 0)
+  {
+    ++buffer;
+  }
+  if (buffer == kWriteBuffers)
+  {
+    return;  // all in flight, poll instead
+  }
+  char* data = writeBase_ + buffer * kWriteBufferSize;
+  const size_t len = channel->fillFixedWrite(data, kWriteBufferSize);
+  if (len == 0)
+  {
+    return;  // e.g. a file region at head, sent with sendfile(2)
+  }
+  state->write = makeUserData(kWriteOp, channel->fd());
+  writeOwners_[buffer] = state->write;
+  struct io_uring_sqe* sqe = getSqe();
+  sqe->opcode = IORING_OP_WRITE_FIXED;
+  sqe->fd = channel->fd();
+  sqe->addr = reinterpret_cast<uintptr_t>(data);
+  sqe->len = static_cast<uint32_t>(len);
+  sqe->buf_index = static_cast<uint16_t>(buffer);
+  sqe->user_data = state->write;
+}
+
+void IoUringPoller::cancel(uint64_t userData, bool isPoll)
+{
+  struct io_uring_sqe* sqe = getSqe();
+  sqe->opcode = isPoll ? IORING_OP_POLL_REMOVE : IORING_OP_ASYNC_CANCEL;
+  sqe->fd = -1;
+  sqe->addr = userData;
+  sqe->user_data = makeUserData(kCancelOp, 0);
+}
+
+struct io_uring_sqe* IoUringPoller::getSqe()
+{
+  unsigned tail = *sqTail_;
+  if (tail - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) > sqMask_)
+  {
+    // submission queue is full, flush it without waiting
+    submit();
+    tail = *sqTail_;
+  }
+  const unsigned index = tail & sqMask_;
+  struct io_uring_sqe* sqe = &sqes_[index];
+  memZero(sqe, sizeof *sqe);
+  sqArray_[index] = index;
+  __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+  ++sqPending_;
+  return sqe;
+}
+
+void IoUringPoller::submit()
+{
+  while (sqPending_ > 0)
+  {
+    int ret = enter(sqPending_, 0, false, 0);
+    if (ret >= 0)
+    {
+      sqPending_ -= ret;
+    }
+    else if (errno != EINTR && errno != EBUSY)
+    {
+      LOG_SYSFATAL << "IoUringPoller::submit";
+    }
+  }
+}
+
+int IoUringPoller::registerRing(unsigned opcode, void* arg, unsigned nrArgs)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_register, ringFd_, opcode, arg, nrArgs));
+}
+
+int IoUringPoller::enter(unsigned toSubmit, unsigned minComplete,
+                         bool getEvents, int timeoutMs)
+{
+  unsigned flags = 0;
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg arg;
+  memZero(&arg, sizeof arg);
+  if (getEvents)
+  {
+    // also flushes overflowed completions into the ring
+    flags |= IORING_ENTER_GETEVENTS;
+    if (minComplete > 0 && timeoutMs >= 0)
+    {
+      ts.tv_sec = timeoutMs / 1000;
+      ts.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000 * 1000;
+      arg.ts = reinterpret_cast<uintptr_t>(&ts);
+      flags |= IORING_ENTER_EXT_ARG;
+    }
+  }
+  if (toSubmit == 0 && flags == 0)
+  {
+    return 0;
+  }
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ringFd_, toSubmit, minComplete,
+                                    flags, (flags & IORING_ENTER_EXT_ARG) ? &arg : NULL,
+                                    sizeof arg));
+}
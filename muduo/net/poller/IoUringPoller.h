@@ -0,0 +1,139 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is an internal header file, you should not include this.
+
+#ifndef MUDUO_NET_POLLER_IOURINGPOLLER_H
+#define MUDUO_NET_POLLER_IOURINGPOLLER_H
+
+#include "muduo/net/Poller.h"
+
+#include <map>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+namespace muduo
+{
+namespace net
+{
+
+///
+/// IO Multiplexing with io_uring(7) IORING_OP_POLL_ADD.
+///
+/// Poll requests are one-shot and re-armed on next poll() if the channel
+/// is still interested, which keeps the level-triggered semantics of
+/// EPollPoller. All re-arms and the wait go in one io_uring_enter(2).
+///
+/// Channels with fixed buffer I/O, i.e. TcpConnection sockets, get their
+/// reads and writes submitted instead of polled, see
+/// Channel::setFixedBufferIo(). A read picks one of kReadBuffers from a
+/// buffer ring registered with the kernel when data arrives, so an idle
+/// connection holds no buffer. A write copies head of output into one of
+/// kWriteBuffers registered with IORING_REGISTER_BUFFERS, held until it
+/// completes. Channels fall back to polling when buffers run out.
+class IoUringPoller : public Poller
+{
+ public:
+  IoUringPoller(EventLoop* loop);
+  ~IoUringPoller() override;
+
+  /// Whether the running kernel provides what this poller needs.
+  static bool isSupported();
+
+  Timestamp poll(int timeoutMs, ChannelList* activeChannels) override;
+  void updateChannel(Channel* channel) override;
+  void removeChannel(Channel* channel) override;
+  bool supportsFixedBufferIo() const override
+  { return readBase_ != NULL || writeBase_ != NULL; }
+
+ private:
+  static const unsigned kRingEntries = 256;
+  static const unsigned kReadBuffers = 64;  // power of 2
+  static const size_t kReadBufferSize = 16 * 1024;
+  static const int kWriteBuffers = 16;
+  static const size_t kWriteBufferSize = 64 * 1024;
+
+  enum OpKind
+  {
+    kPollOp,
+    kReadOp,
+    kWriteOp,
+    kCancelOp,
+  };
+
+  // requests in flight are identified by user_data, 0 if none
+  struct FdState
+  {
+    uint64_t poll;
+    int pollEvents;
+    uint64_t read;
+    uint64_t write;
+    // a read completed while channel was not reading
+    bool stashed;
+    int stashedBuffer;  // -1 if no data
+    int stashedResult;
+    bool readFallback;  // ran out of read buffers, poll once
+    bool dirty;         // in dirty_
+    int revents;        // of this poll()
+  };
+
+  void initFixedBuffers();
+  void markDirty(int fd, FdState* state);
+  void arm(Channel* channel, FdState* state);
+  void submitPoll(int fd, FdState* state, int events);
+  void submitRead(int fd, FdState* state);
+  void submitWrite(Channel* channel, FdState* state);
+  void cancel(uint64_t userData, bool isPoll);
+  void deliverRead(int fd, FdState* state, int buffer, int result);
+  void recycleReadBuffer(int buffer);
+  uint64_t makeUserData(OpKind kind, int fd);
+  struct io_uring_sqe* getSqe();
+  int enter(unsigned toSubmit, unsigned minComplete, bool getEvents, int timeoutMs);
+  int registerRing(unsigned opcode, void* arg, unsigned nrArgs);
+  void submit();
+  void fillActiveChannels(ChannelList* activeChannels);
+
+  int ringFd_;
+  // submission queue
+  void* sqRing_;
+  size_t sqRingSize_;
+  unsigned* sqHead_;
+  unsigned* sqTail_;
+  unsigned sqMask_;
+  unsigned* sqArray_;
+  struct io_uring_sqe* sqes_;
+  size_t sqesSize_;
+  unsigned sqPending_;  // prepared but not submitted
+  // completion queue
+  void* cqRing_;
+  size_t cqRingSize_;
+  unsigned* cqHead_;
+  unsigned* cqTail_;
+  unsigned cqMask_;
+  struct io_uring_cqe* cqes_;
+
+  uint32_t nextGeneration_;
+  std::map<int, FdState> fds_;  // of channels_
+  std::vector<int> dirty_;      // fd to (re)arm in next poll()
+  std::vector<int> active_;     // fd with revents in this poll()
+  std::vector<int> ready_;      // fd with a stashed read to deliver
+
+  // NULL if not available
+  struct io_uring_buf_ring* readRing_;
+  char* readBase_;
+  std::vector<int> delivered_;  // read buffers to give back in next poll()
+  char* writeBase_;
+  uint64_t writeOwners_[kWriteBuffers];  // user_data of write using each buffer
+};
+
+}  // namespace net
+}  // namespace muduo
+#endif  // MUDUO_NET_POLLER_IOURINGPOLLER_H
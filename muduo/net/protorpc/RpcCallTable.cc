@@ -0,0 +1,191 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/protorpc/RpcCallTable.h"
+
+#include <assert.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+const size_t kInitialSlots = 16;
+const size_t kNotFound = static_cast<size_t>(-1);
+}
+
+RpcCallTable::Shard::Shard()
+  : slots(kInitialSlots),
+    count(0)
+{
+}
+
+RpcCallTable::RpcCallTable()
+{
+}
+
+size_t RpcCallTable::find(const Shard& shard, int64_t id)
+{
+  const size_t mask = shard.slots.size() - 1;
+  for (size_t i = indexOf(id, mask); ; i = (i + 1) & mask)
+  {
+    if (shard.slots[i].id == id)
+    {
+      return i;
+    }
+    if (shard.slots[i].id == 0)
+    {
+      return kNotFound;
+    }
+  }
+}
+
+void RpcCallTable::place(Shard* shard, int64_t id, const Call& call)
+{
+  const size_t mask = shard->slots.size() - 1;
+  size_t i = indexOf(id, mask);
+  while (shard->slots[i].id != 0)
+  {
+    i = (i + 1) & mask;
+  }
+  shard->slots[i].id = id;
+  shard->slots[i].call = call;
+}
+
+// backward shift deletion, no tombstones
+void RpcCallTable::erase(Shard* shard, size_t index)
+{
+  std::vector<Slot>& slots = shard->slots;
+  const size_t mask = slots.size() - 1;
+  size_t hole = index;
+  for (size_t i = (hole + 1) & mask; slots[i].id != 0; i = (i + 1) & mask)
+  {
+    // slot i may move to the hole if its home is not within (hole, i]
+    const size_t home = indexOf(slots[i].id, mask);
+    const bool stays = hole < i ? (hole < home && home <= i)
+                                : (hole < home || home <= i);
+    if (!stays)
+    {
+      slots[hole] = slots[i];
+      hole = i;
+    }
+  }
+  slots[hole].id = 0;
+  --shard->count;
+}
+
+void RpcCallTable::resize(Shard* shard, size_t size)
+{
+  std::vector<Slot> old(size);
+  old.swap(shard->slots);
+  for (const Slot& slot : old)
+  {
+    if (slot.id != 0)
+    {
+      place(shard, slot.id, slot.call);
+    }
+  }
+}
+
+void RpcCallTable::insert(int64_t id, const Call& call)
+{
+  assert(id > 0);
+  Shard& shard = shardOf(id);
+  MutexLockGuard lock(shard.mutex);
+  assert(find(shard, id) == kNotFound);
+  if (2 * (shard.count + 1) > shard.slots.size())
+  {
+    resize(&shard, 2 * shard.slots.size());
+  }
+  place(&shard, id, call);
+  ++shard.count;
+}
+
+bool RpcCallTable::remove(int64_t id, Call* call)
+{
+  if (id <= 0)
+  {
+    return false;
+  }
+  Shard& shard = shardOf(id);
+  MutexLockGuard lock(shard.mutex);
+  const size_t index = find(shard, id);
+  if (index == kNotFound)
+  {
+    return false;
+  }
+  *call = shard.slots[index].call;
+  erase(&shard, index);
+  if (shard.slots.size() > kInitialSlots && 8 * shard.count < shard.slots.size())
+  {
+    resize(&shard, shard.slots.size() / 2);
+  }
+  return true;
+}
+
+void RpcCallTable::removeExpired(int64_t now, std::vector<Call>* expired)
+{
+  std::vector<int64_t> ids;
+  for (Shard& shard : shards_)
+  {
+    MutexLockGuard lock(shard.mutex);
+    ids.clear();
+    for (const Slot& slot : shard.slots)
+    {
+      if (slot.id != 0 && slot.call.deadline != 0 && slot.call.deadline < now)
+      {
+        ids.push_back(slot.id);
+      }
+    }
+    // erase() shifts slots, so look each up again
+    for (int64_t id : ids)
+    {
+      const size_t index = find(shard, id);
+      expired->push_back(shard.slots[index].call);
+      erase(&shard, index);
+    }
+    if (!ids.empty() && shard.slots.size() > kInitialSlots
+        && 8 * shard.count < shard.slots.size())
+    {
+      size_t size = shard.slots.size();
+      while (size > kInitialSlots && 8 * shard.count < size)
+      {
+        size /= 2;
+      }
+      resize(&shard, size);
+    }
+  }
+}
+
+void RpcCallTable::removeAll(std::vector<Call>* calls)
+{
+  for (Shard& shard : shards_)
+  {
+    MutexLockGuard lock(shard.mutex);
+    for (const Slot& slot : shard.slots)
+    {
+      if (slot.id != 0)
+      {
+        calls->push_back(slot.call);
+      }
+    }
+    std::vector<Slot>(kInitialSlots).swap(shard.slots);
+    shard.count = 0;
+  }
+}
+
+size_t RpcCallTable::size() const
+{
+  size_t count = 0;
+  for (const Shard& shard : shards_)
+  {
+    MutexLockGuard lock(shard.mutex);
+    count += shard.count;
+  }
+  return count;
+}
@@ -0,0 +1,107 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is an internal header file, you should not include this.
+
+#ifndef MUDUO_NET_PROTORPC_RPCCALLTABLE_H
+#define MUDUO_NET_PROTORPC_RPCCALLTABLE_H
+
+#include "muduo/base/Mutex.h"
+
+#include <vector>
+
+namespace google {
+namespace protobuf {
+
+class Closure;
+class Message;
+class RpcController;
+
+}  // namespace protobuf
+}  // namespace google
+
+namespace muduo
+{
+namespace net
+{
+
+class RpcMethodStats;
+
+///
+/// Outstanding calls of a RpcChannel, keyed by call id.
+///
+/// Ids are spread over shards by their low bits, each shard is an open
+/// addressing table with linear probing under its own lock. Ids are
+/// sequential, so live calls of a shard sit in consecutive slots and
+/// rarely collide. A shard grows at half full and shrinks back once
+/// calls complete.
+class RpcCallTable : noncopyable
+{
+ public:
+  struct Call
+  {
+    ::google::protobuf::Message* response;
+    ::google::protobuf::Closure* done;
+    ::google::protobuf::RpcController* controller;
+    RpcMethodStats* stats;
+    int64_t start;     // microseconds since epoch
+    int64_t deadline;  // microseconds since epoch, 0 if none
+  };
+
+  static const int kShards = 16;
+
+  RpcCallTable();
+
+  /// @c id must be positive and not in the table.
+  void insert(int64_t id, const Call& call);
+
+  /// Returns false if @c id is not in the table, e.g. timed out.
+  bool remove(int64_t id, Call* call);
+
+  /// Moves out calls whose deadline is before @c now.
+  void removeExpired(int64_t now, std::vector<Call>* expired);
+
+  void removeAll(std::vector<Call>* calls);
+
+  size_t size() const;
+
+ private:
+  struct Slot
+  {
+    int64_t id;  // 0 if empty
+    Call call;
+  };
+
+  struct Shard
+  {
+    Shard();
+
+    mutable MutexLock mutex;
+    std::vector<Slot> slots GUARDED_BY(mutex);  // size is power of 2
+    size_t count GUARDED_BY(mutex);
+    char padding[64];  // avoid false sharing of locks
+  };
+
+  static size_t indexOf(int64_t id, size_t mask)
+  { return static_cast<size_t>(id / kShards) & mask; }
+
+  Shard& shardOf(int64_t id)
+  { return shards_[id % kShards]; }
+
+  static size_t find(const Shard& shard, int64_t id);
+  static void place(Shard* shard, int64_t id, const Call& call);
+  static void erase(Shard* shard, size_t index);
+  static void resize(Shard* shard, size_t size);
+
+  Shard shards_[kShards];
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_PROTORPC_RPCCALLTABLE_H
@@ -0,0 +1,118 @@
+#undef NDEBUG
+#include "muduo/net/protorpc/RpcCallTable.h"
+#include "muduo/net/protorpc/RpcStats.h"
+
+#include <map>
+
+#include <stdio.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+RpcCallTable::Call makeCall(int64_t id, int64_t deadline)
+{
+  // response field keeps the id, to check we get back the right call
+  RpcCallTable::Call call = { reinterpret_cast<google::protobuf::Message*>(id),
+                              NULL, NULL, NULL, 0, deadline };
+  return call;
+}
+
+int64_t idOf(const RpcCallTable::Call& call)
+{
+  return reinterpret_cast<int64_t>(call.response);
+}
+
+void testTable()
+{
+  RpcCallTable table;
+  RpcCallTable::Call call;
+  assert(table.size() == 0);
+  assert(!table.remove(1, &call));
+  assert(!table.remove(0, &call));
+
+  const int64_t kCalls = 10000;
+  for (int64_t id = 1; id <= kCalls; ++id)
+  {
+    table.insert(id, makeCall(id, id % 3 == 0 ? id : 0));
+  }
+  assert(table.size() == kCalls);
+
+  // out of order, leaves holes behind for backward shift
+  for (int64_t id = 2; id <= kCalls; id += 2)
+  {
+    assert(table.remove(id, &call));
+    assert(idOf(call) == id);
+    assert(!table.remove(id, &call));
+  }
+  assert(table.size() == kCalls / 2);
+
+  // odd multiples of 3 below 5000 expire
+  std::vector<RpcCallTable::Call> expired;
+  table.removeExpired(5000, &expired);
+  std::map<int64_t, bool> seen;
+  for (const RpcCallTable::Call& c : expired)
+  {
+    assert(idOf(c) % 3 == 0 && idOf(c) % 2 == 1 && idOf(c) < 5000);
+    seen[idOf(c)] = true;
+  }
+  assert(seen.size() == expired.size());
+  assert(expired.size() == 833);
+  for (int64_t id = 1; id <= kCalls; id += 2)
+  {
+    const bool gone = id % 3 == 0 && id < 5000;
+    assert(table.remove(id, &call) == !gone);
+    if (!gone)
+    {
+      assert(idOf(call) == id);
+    }
+  }
+  assert(table.size() == 0);
+
+  // shrunk, still works
+  table.insert(kCalls + 1, makeCall(kCalls + 1, 0));
+  std::vector<RpcCallTable::Call> all;
+  table.removeAll(&all);
+  assert(all.size() == 1 && idOf(all[0]) == kCalls + 1);
+  assert(table.size() == 0);
+}
+
+void testStats()
+{
+  RpcMethodStats stats("muduo.Test.Echo");
+  for (int i = 0; i < 100; ++i)
+  {
+    stats.called();
+  }
+  // 90 fast calls of 100us, 9 of 5ms, one timeout of 1s
+  for (int i = 0; i < 90; ++i)
+  {
+    stats.record(100, RpcMethodStats::kOk);
+  }
+  for (int i = 0; i < 8; ++i)
+  {
+    stats.record(5000, RpcMethodStats::kOk);
+  }
+  stats.record(5000, RpcMethodStats::kError);
+  stats.record(1000000, RpcMethodStats::kTimeout);
+
+  string line = stats.toString();
+  printf("%s", line.c_str());
+  char name[64];
+  long long calls, pending, errors, timeouts, p50, p90, p99, max;
+  assert(sscanf(line.c_str(), "%63s %lld %lld %lld %lld %lld %lld %lld %lld",
+                name, &calls, &pending, &errors, &timeouts,
+                &p50, &p90, &p99, &max) == 9);
+  assert(string(name) == "muduo.Test.Echo");
+  assert(calls == 100 && pending == 0 && errors == 1 && timeouts == 1);
+  assert(p50 == 128);
+  assert(p90 == 128);
+  assert(p99 == 8192);
+  assert(max == 1 << 20);
+}
+
+int main()
+{
+  testTable();
+  testStats();
+  printf("%s", RpcStats::report().c_str());
+}
@@ -9,24 +9,73 @@
 #include "muduo/net/protorpc/RpcChannel.h"
 
 #include "muduo/base/Logging.h"
+#include "muduo/net/Buffer.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpConnection.h"
+#include "muduo/net/protorpc/RpcCallTable.h"
+#include "muduo/net/protorpc/RpcStats.h"
 #include "muduo/net/protorpc/rpc.pb.h"
 
 #include <google/protobuf/descriptor.h>
 
+#include <algorithm>
+
 using namespace muduo;
 using namespace muduo::net;
 
+const double RpcChannel::kDefaultCallTimeout = 30.0;
+
+namespace
+{
+
+// response is deleted after done runs, as before
+void finishCall(const RpcCallTable::Call& call, ErrorCode error, int64_t now)
+{
+  if (call.stats)
+  {
+    RpcMethodStats::Outcome outcome = RpcMethodStats::kOk;
+    if (error == TIMEOUT)
+    {
+      outcome = RpcMethodStats::kTimeout;
+    }
+    else if (error != NO_ERROR)
+    {
+      outcome = RpcMethodStats::kError;
+    }
+    call.stats->record(now - call.start, outcome);
+  }
+  if (error != NO_ERROR && call.controller)
+  {
+    call.controller->SetFailed(ErrorCode_Name(error));
+  }
+  std::unique_ptr<google::protobuf::Message> d(call.response);
+  if (call.done)
+  {
+    call.done->Run();
+  }
+}
+
+}  // namespace
+
 RpcChannel::RpcChannel()
-  : codec_(std::bind(&RpcChannel::onRpcMessage, this, _1, _2, _3)),
-    services_(NULL)
+  : codec_(std::bind(&RpcChannel::onRpcMessage, this, _1, _2, _3),
+           std::bind(&RpcChannel::onRawMessage, this, _1, _2, _3)),
+    calls_(new RpcCallTable),
+    callTimeout_(kDefaultCallTimeout),
+    services_(NULL),
+    inPlaceFraming_(true)
 {
   LOG_INFO << "RpcChannel::ctor - " << this;
 }
 
 RpcChannel::RpcChannel(const TcpConnectionPtr& conn)
-  : codec_(std::bind(&RpcChannel::onRpcMessage, this, _1, _2, _3)),
+  : codec_(std::bind(&RpcChannel::onRpcMessage, this, _1, _2, _3),
+           std::bind(&RpcChannel::onRawMessage, this, _1, _2, _3)),
     conn_(conn),
-    services_(NULL)
+    calls_(new RpcCallTable),
+    callTimeout_(kDefaultCallTimeout),
+    services_(NULL),
+    inPlaceFraming_(true)
 {
   LOG_INFO << "RpcChannel::ctor - " << this;
 }
@@ -34,11 +83,12 @@ RpcChannel::RpcChannel(const TcpConnectionPtr& conn)
 RpcChannel::~RpcChannel()
 {
   LOG_INFO << "RpcChannel::dtor - " << this;
-  for (const auto& outstanding : outstandings_)
+  std::vector<RpcCallTable::Call> calls;
+  calls_->removeAll(&calls);
+  for (const RpcCallTable::Call& call : calls)
   {
-    OutstandingCall out = outstanding.second;
-    delete out.response;
-    delete out.done;
+    delete call.response;
+    delete call.done;
   }
 }
 
@@ -59,14 +109,80 @@ void RpcChannel::CallMethod(const ::google::protobuf::MethodDescriptor* method,
   message.set_id(id);
   message.set_service(method->service()->full_name());
   message.set_method(method->name());
-  message.set_request(request->SerializeAsString()); // FIXME: error check
 
-  OutstandingCall out = { response, done };
+  RpcMethodStats* stats = RpcStats::get(method);
+  stats->called();
+  const int64_t now = Timestamp::now().microSecondsSinceEpoch();
+  const int64_t deadline = callTimeout_ > 0
+      ? now + static_cast<int64_t>(callTimeout_ * Timestamp::kMicroSecondsPerSecond)
+      : 0;
+  RpcCallTable::Call call = { response, done, controller, stats, now, deadline };
+  calls_->insert(id, call);
+  if (deadline != 0 && sweeping_.get() == 0)
   {
-  MutexLockGuard lock(mutex_);
-  outstandings_[id] = out;
+    startSweeping();
+  }
+  sendMessage(&message, *request);
+}
+
+void RpcChannel::startSweeping()
+{
+  if (sweeping_.getAndSet(1) == 0)
+  {
+    // a tenth of timeout, within [10ms, 1s]
+    // re-armed by each sweep, so no timer id to share with dtor
+    const double interval = std::min(std::max(callTimeout_ / 10, 0.01), 1.0);
+    EventLoop* loop = conn_->getLoop();
+    loop->runAfter(interval, std::bind(&RpcChannel::sweepCalls,
+                                       std::weak_ptr<RpcCallTable>(calls_), loop, interval));
+  }
+}
+
+void RpcChannel::sweepCalls(const std::weak_ptr<RpcCallTable>& weakCalls,
+                            EventLoop* loop,
+                            double interval)
+{
+  std::shared_ptr<RpcCallTable> calls(weakCalls.lock());
+  if (!calls)
+  {
+    return;
+  }
+  const int64_t now = Timestamp::now().microSecondsSinceEpoch();
+  std::vector<RpcCallTable::Call> expired;
+  calls->removeExpired(now, &expired);
+  for (const RpcCallTable::Call& call : expired)
+  {
+    finishCall(call, TIMEOUT, now);
+  }
+  if (!expired.empty())
+  {
+    LOG_WARN << "RpcChannel timed out " << expired.size() << " calls";
+  }
+  calls.reset();
+  loop->runAfter(interval, std::bind(&RpcChannel::sweepCalls, weakCalls, loop, interval));
+}
+
+void RpcChannel::sendMessage(RpcMessage* message, const ::google::protobuf::Message& payload)
+{
+  if (inPlaceFraming_)
+  {
+    Buffer buf;
+    fillRpcFrame(&buf, *message, payload);
+    conn_->send(&buf);
+  }
+  else
+  {
+    // FIXME: error check
+    if (message->type() == REQUEST)
+    {
+      message->set_request(payload.SerializeAsString());
+    }
+    else
+    {
+      message->set_response(payload.SerializeAsString());
+    }
+    codec_.send(conn_, *message);
   }
-  codec_.send(conn_, message);
 }
 
 void RpcChannel::onMessage(const TcpConnectionPtr& conn,
@@ -76,41 +192,68 @@ void RpcChannel::onMessage(const TcpConnectionPtr& conn,
   codec_.onMessage(conn, buf, receiveTime);
 }
 
+bool RpcChannel::onRawMessage(const TcpConnectionPtr& conn,
+                              StringPiece frame,
+                              Timestamp receiveTime)
+{
+  assert(conn == conn_);
+  if (!inPlaceFraming_)
+  {
+    return true;
+  }
+  RpcMessage header;
+  StringPiece payload;
+  frame.remove_prefix(ProtobufCodecLite::kHeaderLen);
+  if (!parseRpcFrame(frame, &header, &payload))
+  {
+    // let codec parse it, and report errors
+    return true;
+  }
+  handleMessage(header, payload);
+  return false;
+}
+
 void RpcChannel::onRpcMessage(const TcpConnectionPtr& conn,
                               const RpcMessagePtr& messagePtr,
                               Timestamp receiveTime)
 {
   assert(conn == conn_);
   //printf("%s\n", message.DebugString().c_str());
-  RpcMessage& message = *messagePtr;
+  const RpcMessage& message = *messagePtr;
+  StringPiece payload;
+  if (message.has_request())
+  {
+    payload = message.request();
+  }
+  else if (message.has_response())
+  {
+    payload = message.response();
+  }
+  handleMessage(message, payload);
+}
+
+void RpcChannel::handleMessage(const RpcMessage& message, StringPiece payload)
+{
   if (message.type() == RESPONSE)
   {
     int64_t id = message.id();
-    assert(message.has_response() || message.has_error());
-
-    OutstandingCall out = { NULL, NULL };
+    assert(payload.data() != NULL || message.has_error());
 
+    RpcCallTable::Call call;
+    if (calls_->remove(id, &call))
     {
-      MutexLockGuard lock(mutex_);
-      std::map<int64_t, OutstandingCall>::iterator it = outstandings_.find(id);
-      if (it != outstandings_.end())
+      ErrorCode error = message.has_error() ? message.error() : NO_ERROR;
+      if (payload.data() != NULL && call.response
+          && !call.response->ParseFromArray(payload.data(), payload.size())
+          && error == NO_ERROR)
       {
-        out = it->second;
-        outstandings_.erase(it);
+        error = INVALID_RESPONSE;
       }
+      finishCall(call, error, Timestamp::now().microSecondsSinceEpoch());
     }
-
-    if (out.response)
+    else
     {
-      std::unique_ptr<google::protobuf::Message> d(out.response);
-      if (message.has_response())
-      {
-        out.response->ParseFromString(message.response());
-      }
-      if (out.done)
-      {
-        out.done->Run();
-      }
+      LOG_DEBUG << "RpcChannel drops response " << id << ", timed out";
     }
   }
   else if (message.type() == REQUEST)
@@ -130,7 +273,7 @@ void RpcChannel::onRpcMessage(const TcpConnectionPtr& conn,
         if (method)
         {
           std::unique_ptr<google::protobuf::Message> request(service->GetRequestPrototype(method).New());
-          if (request->ParseFromString(message.request()))
+          if (request->ParseFromArray(payload.data(), payload.size()))
           {
             google::protobuf::Message* response = service->GetResponsePrototype(method).New();
             // response is deleted in doneCallback
@@ -178,7 +321,6 @@ void RpcChannel::doneCallback(::google::protobuf::Message* response, int64_t id)
   RpcMessage message;
   message.set_type(RESPONSE);
   message.set_id(id);
-  message.set_response(response->SerializeAsString()); // FIXME: error check
-  codec_.send(conn_, message);
+  sendMessage(&message, *response);
 }
 
@@ -12,7 +12,6 @@
 #define MUDUO_NET_PROTORPC_RPCCHANNEL_H
 
 #include "muduo/base/Atomic.h"
-#include "muduo/base/Mutex.h"
 #include "muduo/net/protorpc/RpcCodec.h"
 
 #include <google/protobuf/service.h>
@@ -79,6 +78,9 @@ namespace muduo
 namespace net
 {
 
+class EventLoop;
+class RpcCallTable;
+
 // Abstract interface for an RPC channel.  An RpcChannel represents a
 // communication line to a Service which can be used to call that Service's
 // methods.  The Service may be running on another machine.  Normally, you
@@ -107,6 +109,25 @@ class RpcChannel : public ::google::protobuf::RpcChannel
     services_ = services;
   }
 
+  /// Serializes requests and responses straight into the frame, and
+  /// parses received ones from input buffer, see fillRpcFrame().
+  /// Same bytes on the wire either way, on by default.
+  void setInPlaceFraming(bool on)
+  {
+    inPlaceFraming_ = on;
+  }
+
+  /// Fails outstanding calls with TIMEOUT after @c seconds, 0 for never.
+  /// On timeout, @c done runs with an empty response, and the controller,
+  /// if any, is set failed. A late response is dropped.
+  /// Default is kDefaultCallTimeout, set it before the first call.
+  void setCallTimeout(double seconds)
+  {
+    callTimeout_ = seconds;
+  }
+
+  static const double kDefaultCallTimeout;
+
   // Call the given method of the remote service.  The signature of this
   // procedure looks the same as Service::CallMethod(), but the requirements
   // are less strict in one important way:  the request and response objects
@@ -126,23 +147,30 @@ class RpcChannel : public ::google::protobuf::RpcChannel
   void onRpcMessage(const TcpConnectionPtr& conn,
                     const RpcMessagePtr& messagePtr,
                     Timestamp receiveTime);
+  bool onRawMessage(const TcpConnectionPtr& conn,
+                    StringPiece frame,
+                    Timestamp receiveTime);
+  // @c payload is request or response, NULL if not set
+  void handleMessage(const RpcMessage& message, StringPiece payload);
+  void sendMessage(RpcMessage* message, const ::google::protobuf::Message& payload);
 
   void doneCallback(::google::protobuf::Message* response, int64_t id);
-
-  struct OutstandingCall
-  {
-    ::google::protobuf::Message* response;
-    ::google::protobuf::Closure* done;
-  };
+  void startSweeping();
+  // runs in loop of connection, stops once channel is gone
+  static void sweepCalls(const std::weak_ptr<RpcCallTable>& weakCalls,
+                         EventLoop* loop,
+                         double interval);
 
   RpcCodec codec_;
   TcpConnectionPtr conn_;
   AtomicInt64 id_;
 
-  MutexLock mutex_;
-  std::map<int64_t, OutstandingCall> outstandings_ GUARDED_BY(mutex_);
+  std::shared_ptr<RpcCallTable> calls_;
+  double callTimeout_;
+  AtomicInt32 sweeping_;
 
   const std::map<std::string, ::google::protobuf::Service*>* services_;
+  bool inPlaceFraming_;
 };
 typedef std::shared_ptr<RpcChannel> RpcChannelPtr;
 
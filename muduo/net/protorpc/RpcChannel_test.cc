@@ -0,0 +1,155 @@
+#undef NDEBUG
+#include "muduo/net/protorpc/RpcChannel.h"
+#include "muduo/net/protorpc/RpcServer.h"
+#include "muduo/net/protorpc/rpcservice.pb.h"
+
+#include "muduo/base/Logging.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/InetAddress.h"
+#include "muduo/net/TcpClient.h"
+#include "muduo/net/TcpConnection.h"
+
+#include <vector>
+
+#include <stdio.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+// answers listRpc only when told to, getService at once
+class SlowRpcService : public RpcService
+{
+ public:
+  void listRpc(::google::protobuf::RpcController*,
+               const ListRpcRequest*,
+               ListRpcResponse* response,
+               ::google::protobuf::Closure* done) override
+  {
+    response->set_error(NO_ERROR);
+    pending_.push_back(done);
+  }
+
+  void getService(::google::protobuf::RpcController*,
+                  const GetServiceRequest*,
+                  GetServiceResponse* response,
+                  ::google::protobuf::Closure* done) override
+  {
+    response->set_error(NO_ERROR);
+    done->Run();
+  }
+
+  void replyAll()
+  {
+    for (::google::protobuf::Closure* done : pending_)
+    {
+      done->Run();
+    }
+    pending_.clear();
+  }
+
+ private:
+  std::vector<::google::protobuf::Closure*> pending_;
+};
+
+class TestController : public ::google::protobuf::RpcController
+{
+ public:
+  TestController() : failed_(false) {}
+
+  void Reset() override { failed_ = false; reason_.clear(); }
+  bool Failed() const override { return failed_; }
+  std::string ErrorText() const override { return reason_; }
+  void StartCancel() override {}
+  void SetFailed(const std::string& reason) override { failed_ = true; reason_ = reason; }
+  bool IsCanceled() const override { return false; }
+  void NotifyOnCancel(::google::protobuf::Closure*) override {}
+
+ private:
+  bool failed_;
+  std::string reason_;
+};
+
+EventLoop* g_loop;
+TcpClient* g_client;
+SlowRpcService g_service;
+RpcChannelPtr g_channel;
+RpcService::Stub* g_stub;
+TestController g_listController;
+TestController g_getController;
+int g_listDone = 0;
+int g_getDone = 0;
+bool g_gotService = false;
+
+void listDone(ListRpcResponse* response)
+{
+  ++g_listDone;
+  // empty response on timeout
+  assert(!response->has_error());
+}
+
+void getDone(GetServiceResponse* response)
+{
+  ++g_getDone;
+  g_gotService = response->has_error() && response->error() == NO_ERROR;
+  g_client->disconnect();
+  g_loop->runAfter(0.1, std::bind(&EventLoop::quit, g_loop));
+}
+
+void callGetService()
+{
+  // late response of listRpc arrived and was dropped, channel still works
+  assert(g_listDone == 1);
+  GetServiceRequest request;
+  request.set_service_name("muduo.net.RpcService");
+  GetServiceResponse* response = new GetServiceResponse;
+  g_stub->getService(&g_getController, &request, response,
+                    NewCallback(getDone, response));
+}
+
+void onConnection(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    g_channel->setConnection(conn);
+    ListRpcRequest request;
+    ListRpcResponse* response = new ListRpcResponse;
+    g_stub->listRpc(&g_listController, &request, response,
+                   NewCallback(listDone, response));
+    // reply well after the timeout, then check nothing runs twice
+    g_loop->runAfter(0.3, std::bind(&SlowRpcService::replyAll, &g_service));
+    g_loop->runAfter(0.5, callGetService);
+  }
+}
+
+int main()
+{
+  EventLoop loop;
+  g_loop = &loop;
+  InetAddress listenAddr(29530);
+  RpcServer server(&loop, listenAddr);
+  server.registerService(&g_service);
+  server.start();
+
+  g_channel.reset(new RpcChannel);
+  g_channel->setCallTimeout(0.05);
+  RpcService::Stub stub(get_pointer(g_channel));
+  g_stub = &stub;
+  TcpClient client(&loop, InetAddress("127.0.0.1", 29530), "RpcChannelTest");
+  g_client = &client;
+  client.setConnectionCallback(onConnection);
+  client.setMessageCallback(
+      std::bind(&RpcChannel::onMessage, get_pointer(g_channel), _1, _2, _3));
+  client.connect();
+  loop.runAfter(5.0, std::bind(&EventLoop::quit, &loop));
+  loop.loop();
+
+  printf("listRpc done %d failed %d '%s'\n", g_listDone,
+         g_listController.Failed(), g_listController.ErrorText().c_str());
+  assert(g_listDone == 1);
+  assert(g_listController.Failed());
+  assert(g_listController.ErrorText() == "TIMEOUT");
+  assert(g_getDone == 1);
+  assert(g_gotService);
+  assert(!g_getController.Failed());
+  g_channel->setConnection(TcpConnectionPtr());
+}
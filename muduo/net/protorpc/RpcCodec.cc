@@ -15,6 +15,9 @@
 #include "muduo/net/protorpc/rpc.pb.h"
 #include "muduo/net/protorpc/google-inl.h"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
 using namespace muduo;
 using namespace muduo::net;
 
@@ -35,3 +38,98 @@ namespace net
 const char rpctag [] = "RPC0";
 }
 }
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::internal::WireFormatLite;
+
+namespace
+{
+const int kTagLen = sizeof rpctag - 1;
+}
+
+void muduo::net::fillRpcFrame(Buffer* buf, const RpcMessage& header,
+                              const ::google::protobuf::Message& payload)
+{
+  assert(buf->readableBytes() == 0);
+  assert(!header.has_request() && !header.has_response());
+  const int field = header.type() == REQUEST ? RpcMessage::kRequestFieldNumber
+                                             : RpcMessage::kResponseFieldNumber;
+  const size_t headerSize = header.ByteSizeLong();
+  const size_t payloadSize = payload.ByteSizeLong();
+  assert(payloadSize < ProtobufCodecLite::kMaxMessageLen);
+  buf->append(rpctag, kTagLen);
+  // tag of field is 1 byte, length is 5 bytes at most
+  buf->ensureWritableBytes(headerSize + 1 + 5 + payloadSize + ProtobufCodecLite::kChecksumLen);
+
+  uint8_t* start = reinterpret_cast<uint8_t*>(buf->beginWrite());
+  uint8_t* p = header.SerializeWithCachedSizesToArray(start);
+  p = WireFormatLite::WriteTagToArray(field, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, p);
+  p = CodedOutputStream::WriteVarint32ToArray(static_cast<uint32_t>(payloadSize), p);
+  p = payload.SerializeWithCachedSizesToArray(p);
+  buf->hasWritten(p - start);
+
+  int32_t checkSum = ProtobufCodecLite::checksum(buf->peek(), static_cast<int>(buf->readableBytes()));
+  buf->appendInt32(checkSum);
+  int32_t len = sockets::hostToNetwork32(static_cast<int32_t>(buf->readableBytes()));
+  buf->prepend(&len, sizeof len);
+}
+
+bool muduo::net::parseRpcFrame(StringPiece frame, RpcMessage* header, StringPiece* payload)
+{
+  const int len = frame.size() - kTagLen - ProtobufCodecLite::kChecksumLen;
+  if (len < 0
+      || memcmp(frame.data(), rpctag, kTagLen) != 0
+      || !ProtobufCodecLite::validateChecksum(frame.data(), frame.size()))
+  {
+    return false;
+  }
+
+  // find the payload field among top level fields
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(frame.data() + kTagLen);
+  const uint8_t* fieldBegin = NULL;
+  const uint8_t* fieldEnd = NULL;
+  *payload = StringPiece();
+  CodedInputStream input(data, len);
+  while (true)
+  {
+    const int position = input.CurrentPosition();
+    const uint32_t tag = input.ReadTag();
+    if (tag == 0)
+    {
+      break;
+    }
+    const int number = WireFormatLite::GetTagFieldNumber(tag);
+    if ((number == RpcMessage::kRequestFieldNumber || number == RpcMessage::kResponseFieldNumber)
+        && WireFormatLite::GetTagWireType(tag) == WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+    {
+      uint32_t size = 0;
+      if (fieldBegin || !input.ReadVarint32(&size)
+          || size > static_cast<uint32_t>(len - input.CurrentPosition()))
+      {
+        return false;
+      }
+      fieldBegin = data + position;
+      fieldEnd = data + input.CurrentPosition() + size;
+      payload->set(data + input.CurrentPosition(), static_cast<int>(size));
+      input.Skip(static_cast<int>(size));
+    }
+    else if (!WireFormatLite::SkipField(&input, tag))
+    {
+      return false;
+    }
+  }
+  if (input.CurrentPosition() != len)
+  {
+    return false;
+  }
+
+  if (fieldBegin == NULL)
+  {
+    return header->ParseFromArray(data, len);
+  }
+  CodedInputStream rest(fieldEnd, static_cast<int>(data + len - fieldEnd));
+  return header->ParsePartialFromArray(data, static_cast<int>(fieldBegin - data))
+      && header->MergePartialFromCodedStream(&rest)
+      && header->IsInitialized();
+}
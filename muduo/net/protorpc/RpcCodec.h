@@ -39,6 +39,24 @@ extern const char rpctag[];// = "RPC0";
 
 typedef ProtobufCodecLiteT<RpcMessage, rpctag> RpcCodec;
 
+// In-place framing, same bytes on the wire as RpcCodec.
+//
+// The request (or response) field is serialized from the message itself,
+// right after the other fields of RpcMessage, instead of serializing it
+// into a string, setting that string into RpcMessage and serializing
+// again. On receipt it is parsed from the frame in the input buffer.
+
+/// Fills empty @c buf with a frame of @c header, and @c payload as its
+/// request field if header.type() is REQUEST, response field otherwise.
+void fillRpcFrame(Buffer* buf, const RpcMessage& header,
+                  const ::google::protobuf::Message& payload);
+
+/// Parses a frame without its length, "RPC0", RpcMessage and checksum,
+/// all fields but request and response into @c header, @c payload
+/// points to one of them within @c frame, or is NULL if neither is set.
+/// Returns false if frame is invalid, or has both, or one twice.
+bool parseRpcFrame(StringPiece frame, RpcMessage* header, StringPiece* payload);
+
 }  // namespace net
 }  // namespace muduo
 
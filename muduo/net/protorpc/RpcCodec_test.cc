@@ -77,5 +77,54 @@ int main()
   assert(g_msgptr->DebugString() == message.DebugString());
   }
 
+  {
+  // in-place framing, any message does as payload
+  RpcMessage payload;
+  payload.set_type(RESPONSE);
+  payload.set_id(42);
+  payload.set_service(string(300, 's'));
+  RpcMessage header;
+  header.set_type(REQUEST);
+  header.set_id(3);
+  header.set_service("muduo.Echo");
+  header.set_method("Echo");
+  Buffer framed;
+  fillRpcFrame(&framed, header, payload);
+
+  RpcMessage whole(header);
+  whole.set_request(payload.SerializeAsString());
+  Buffer buf;
+  RpcCodec codec(rpcMessageCallback);
+  codec.fillEmptyBuffer(&buf, whole);
+  assert(framed.toStringPiece() == buf.toStringPiece());
+
+  StringPiece frame = framed.toStringPiece();
+  frame.remove_prefix(ProtobufCodecLite::kHeaderLen);
+  RpcMessage parsed;
+  StringPiece view;
+  assert(parseRpcFrame(frame, &parsed, &view));
+  assert(parsed.DebugString() == header.DebugString());
+  assert(view.data() >= frame.data() && view.end() <= frame.end());
+  RpcMessage parsedPayload;
+  assert(parsedPayload.ParseFromArray(view.data(), view.size()));
+  assert(parsedPayload.DebugString() == payload.DebugString());
+
+  // no payload
+  Buffer empty;
+  codec.fillEmptyBuffer(&empty, message);
+  frame = empty.toStringPiece();
+  frame.remove_prefix(ProtobufCodecLite::kHeaderLen);
+  assert(parseRpcFrame(frame, &parsed, &view));
+  assert(parsed.DebugString() == message.DebugString());
+  assert(view.data() == NULL);
+
+  // corrupted
+  string bad = framed.toStringPiece().as_string();
+  bad[20] ^= 1;
+  frame.set(bad.data() + ProtobufCodecLite::kHeaderLen,
+            static_cast<int>(bad.size()) - ProtobufCodecLite::kHeaderLen);
+  assert(!parseRpcFrame(frame, &parsed, &view));
+  }
+
   google::protobuf::ShutdownProtobufLibrary();
 }
@@ -19,7 +19,8 @@ using namespace muduo::net;
 
 RpcServer::RpcServer(EventLoop* loop,
                      const InetAddress& listenAddr)
-  : server_(loop, listenAddr, "RpcServer")
+  : server_(loop, listenAddr, "RpcServer"),
+    inPlaceFraming_(true)
 {
   server_.setConnectionCallback(
       std::bind(&RpcServer::onConnection, this, _1));
@@ -47,6 +48,7 @@ void RpcServer::onConnection(const TcpConnectionPtr& conn)
   {
     RpcChannelPtr channel(new RpcChannel(conn));
     channel->setServices(&services_);
+    channel->setInPlaceFraming(inPlaceFraming_);
     conn->setMessageCallback(
         std::bind(&RpcChannel::onMessage, get_pointer(channel), _1, _2, _3));
     conn->setContext(channel);
@@ -37,6 +37,12 @@ class RpcServer
     server_.setThreadNum(numThreads);
   }
 
+  /// See RpcChannel::setInPlaceFraming(), on by default.
+  void setInPlaceFraming(bool on)
+  {
+    inPlaceFraming_ = on;
+  }
+
   void registerService(::google::protobuf::Service*);
   void start();
 
@@ -49,6 +55,7 @@ class RpcServer
 
   TcpServer server_;
   std::map<std::string, ::google::protobuf::Service*> services_;
+  bool inPlaceFraming_;
 };
 
 }  // namespace net
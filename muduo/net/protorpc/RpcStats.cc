@@ -0,0 +1,154 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+
+#include "muduo/net/protorpc/RpcStats.h"
+
+#include "muduo/base/Mutex.h"
+#include "muduo/net/inspect/Inspector.h"
+
+#include <google/protobuf/descriptor.h>
+
+#include <map>
+#include <memory>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+namespace
+{
+
+struct Registry
+{
+  MutexLock mutex;
+  std::map<string, std::unique_ptr<RpcMethodStats>> stats GUARDED_BY(mutex);
+};
+
+Registry& registry()
+{
+  static Registry* r = new Registry;  // never deleted, used until exit
+  return *r;
+}
+
+// a thread mostly calls the same method over and over
+__thread const google::protobuf::MethodDescriptor* t_lastMethod = NULL;
+__thread RpcMethodStats* t_lastStats = NULL;
+
+int bucketOf(int64_t micros)
+{
+  int bucket = 0;
+  while (micros > 1 && bucket < RpcMethodStats::kBuckets - 1)
+  {
+    micros >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+string latency(HttpRequest::Method, const Inspector::ArgList&)
+{
+  return RpcStats::report();
+}
+
+}  // namespace
+
+void RpcMethodStats::record(int64_t micros, Outcome outcome)
+{
+  completed_.increment();
+  if (outcome == kError)
+  {
+    errors_.increment();
+  }
+  else if (outcome == kTimeout)
+  {
+    timeouts_.increment();
+  }
+  buckets_[bucketOf(micros)].increment();
+}
+
+string RpcMethodStats::toString() const
+{
+  // AtomicIntegerT::get() is not const
+  RpcMethodStats* self = const_cast<RpcMethodStats*>(this);
+  int64_t counts[kBuckets];
+  int64_t total = 0;
+  for (int i = 0; i < kBuckets; ++i)
+  {
+    counts[i] = self->buckets_[i].get();
+    total += counts[i];
+  }
+
+  // upper bound of bucket where each percentile falls
+  const double percentiles[] = { 0.5, 0.9, 0.99, 1.0 };
+  int64_t values[4] = { 0, 0, 0, 0 };
+  for (int p = 0; p < 4 && total > 0; ++p)
+  {
+    const int64_t rank = static_cast<int64_t>(percentiles[p] * static_cast<double>(total));
+    int64_t seen = 0;
+    for (int i = 0; i < kBuckets; ++i)
+    {
+      seen += counts[i];
+      if (seen >= rank && counts[i] > 0)
+      {
+        values[p] = int64_t(1) << (i + 1);
+        break;
+      }
+    }
+  }
+
+  const int64_t calls = self->calls_.get();
+  char buf[256];
+  snprintf(buf, sizeof buf, "%-40s %10" PRId64 " %8" PRId64 " %8" PRId64 " %8" PRId64
+           " %9" PRId64 " %9" PRId64 " %9" PRId64 " %9" PRId64 "\n",
+           name_.c_str(), calls, calls - self->completed_.get(),
+           self->errors_.get(), self->timeouts_.get(),
+           values[0], values[1], values[2], values[3]);
+  return buf;
+}
+
+RpcMethodStats* RpcStats::get(const google::protobuf::MethodDescriptor* method)
+{
+  if (method == t_lastMethod)
+  {
+    return t_lastStats;
+  }
+  Registry& r = registry();
+  MutexLockGuard lock(r.mutex);
+  std::unique_ptr<RpcMethodStats>& stats = r.stats[method->full_name()];
+  if (!stats)
+  {
+    stats.reset(new RpcMethodStats(method->full_name()));
+  }
+  t_lastMethod = method;
+  t_lastStats = stats.get();
+  return t_lastStats;
+}
+
+string RpcStats::report()
+{
+  char header[256];
+  snprintf(header, sizeof header, "%-40s %10s %8s %8s %8s %9s %9s %9s %9s\n",
+           "method", "calls", "pending", "errors", "timeouts",
+           "p50(us)", "p90(us)", "p99(us)", "max(us)");
+  string result(header);
+  Registry& r = registry();
+  MutexLockGuard lock(r.mutex);
+  for (const auto& stats : r.stats)
+  {
+    result += stats.second->toString();
+  }
+  return result;
+}
+
+void RpcStats::registerCommands(Inspector* ins)
+{
+  ins->add("rpc", "latency", latency,
+           "latency of outgoing calls per method, upper bounds of power of 2 buckets");
+}
@@ -0,0 +1,88 @@
+// Copyright 2010, Shuo Chen.  All rights reserved.
+// http://code.google.com/p/muduo/
+//
+// Use of this source code is governed by a BSD-style license
+// that can be found in the License file.
+
+// Author: Shuo Chen (chenshuo at chenshuo dot com)
+//
+// This is a public header file, it must only include public header files.
+
+#ifndef MUDUO_NET_PROTORPC_RPCSTATS_H
+#define MUDUO_NET_PROTORPC_RPCSTATS_H
+
+#include "muduo/base/Atomic.h"
+#include "muduo/base/Types.h"
+
+namespace google {
+namespace protobuf {
+
+class MethodDescriptor;
+
+}  // namespace protobuf
+}  // namespace google
+
+namespace muduo
+{
+namespace net
+{
+
+class Inspector;
+
+///
+/// Latency of outgoing calls to a method, from all RpcChannels of the process.
+///
+class RpcMethodStats : noncopyable
+{
+ public:
+  enum Outcome
+  {
+    kOk,
+    kError,    // error response, or response can't be parsed
+    kTimeout,
+  };
+
+  // bucket i counts calls of [2^i, 2^(i+1)) microseconds, 0 in bucket 0
+  static const int kBuckets = 32;
+
+  explicit RpcMethodStats(const string& name)
+    : name_(name)
+  {
+  }
+
+  const string& name() const { return name_; }
+
+  void called()
+  { calls_.increment(); }
+
+  void record(int64_t micros, Outcome outcome);
+
+  /// "calls pending errors timeouts p50 p90 p99 max", latency in us.
+  string toString() const;
+
+ private:
+  const string name_;
+  AtomicInt64 calls_;
+  AtomicInt64 completed_;
+  AtomicInt64 errors_;
+  AtomicInt64 timeouts_;
+  AtomicInt64 buckets_[kBuckets];
+};
+
+class RpcStats : noncopyable
+{
+ public:
+  /// Created on first use and never deleted. Thread safe.
+  static RpcMethodStats* get(const ::google::protobuf::MethodDescriptor* method);
+
+  /// A line per method.
+  static string report();
+
+  /// Adds /rpc/latency.
+  static void registerCommands(Inspector* ins);
+};
+
+}  // namespace net
+}  // namespace muduo
+
+#endif  // MUDUO_NET_PROTORPC_RPCSTATS_H
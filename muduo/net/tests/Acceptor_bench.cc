@@ -0,0 +1,97 @@
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/Thread.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/Acceptor.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/InetAddress.h"
+#include "muduo/net/SocketsOps.h"
+
+#include <memory>
+#include <vector>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+// Connection storm against one Acceptor, measures accepts/s for a given
+// number of accepts per wakeup.
+// Usage: acceptor_bench [max_accepts_per_read] [num_threads] [connections_per_thread] [burst]
+
+int g_total = 0;
+int g_accepted = 0;
+EventLoop* g_loop = NULL;
+
+void onConnection(int sockfd, const InetAddress&)
+{
+  sockets::close(sockfd);
+  if (++g_accepted == g_total)
+  {
+    g_loop->quit();
+  }
+}
+
+// connect() completes in kernel before accept(), so a burst fills the backlog
+void storm(CountDownLatch* start, const InetAddress* serverAddr, int connections, int burst)
+{
+  start->wait();
+  std::vector<int> fds;
+  for (int i = 0; i < connections; i += burst)
+  {
+    for (int j = i; j < connections && j < i + burst; ++j)
+    {
+      int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+      if (::connect(fd, serverAddr->getSockAddr(), sizeof(struct sockaddr_in)) < 0)
+      {
+        perror("connect");
+        abort();
+      }
+      fds.push_back(fd);
+    }
+    for (int fd : fds)
+    {
+      ::close(fd);
+    }
+    fds.clear();
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int maxAccepts = argc > 1 ? atoi(argv[1]) : Acceptor::kDefaultMaxAcceptsPerRead;
+  int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+  int connections = argc > 3 ? atoi(argv[3]) : 5000;
+  int burst = argc > 4 ? atoi(argv[4]) : 128;
+  g_total = numThreads * connections;
+
+  EventLoop loop;
+  g_loop = &loop;
+  InetAddress listenAddr(2017, true);
+  Acceptor acceptor(&loop, listenAddr, false);
+  acceptor.setNewConnectionCallback(onConnection);
+  acceptor.setMaxAcceptsPerRead(maxAccepts);
+  acceptor.listen();
+
+  CountDownLatch start(1);
+  std::vector<std::unique_ptr<Thread>> threads;
+  for (int i = 0; i < numThreads; ++i)
+  {
+    threads.emplace_back(new Thread(std::bind(storm, &start, &listenAddr, connections, burst)));
+    threads.back()->start();
+  }
+
+  Timestamp begin(Timestamp::now());
+  start.countDown();
+  loop.loop();
+  double seconds = timeDifference(Timestamp::now(), begin);
+
+  for (auto& thr : threads)
+  {
+    thr->join();
+  }
+  printf("%d accepts per read, %d connections, %.3f seconds, %.0f accepts/s, %" PRId64 " iterations\n",
+         maxAccepts, g_total, seconds, g_total / seconds, loop.iteration());
+}
@@ -0,0 +1,150 @@
+#include "muduo/net/BufferChain.h"
+
+//#define BOOST_TEST_MODULE BufferChainTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+using muduo::string;
+using muduo::net::Buffer;
+using muduo::net::BufferChain;
+using muduo::net::BufferPtr;
+using muduo::net::FileRegion;
+using muduo::net::FileRegionPtr;
+
+BOOST_AUTO_TEST_CASE(testBufferChainAppendRetrieve)
+{
+  BufferChain chain;
+  BOOST_CHECK(chain.empty());
+  BOOST_CHECK_EQUAL(chain.numChunks(), 0);
+
+  chain.append(string(200, 'x'));
+  BOOST_CHECK_EQUAL(chain.readableBytes(), 200);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 1);
+
+  // fits in the tail chunk
+  chain.append(string(300, 'y'));
+  BOOST_CHECK_EQUAL(chain.readableBytes(), 500);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 1);
+
+  // overflows the tail chunk, which must not be reallocated
+  struct iovec vec[BufferChain::kMaxIovecs];
+  BOOST_CHECK_EQUAL(chain.peekIovec(vec, BufferChain::kMaxIovecs), 1);
+  const void* head = vec[0].iov_base;
+  chain.append(string(1000, 'z'));
+  BOOST_CHECK_EQUAL(chain.readableBytes(), 1500);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 2);
+  BOOST_CHECK_EQUAL(chain.peekIovec(vec, BufferChain::kMaxIovecs), 2);
+  BOOST_CHECK_EQUAL(vec[0].iov_base, head);
+  BOOST_CHECK_EQUAL(vec[0].iov_len + vec[1].iov_len, 1500);
+
+  chain.retrieve(100);
+  BOOST_CHECK_EQUAL(chain.readableBytes(), 1400);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 2);
+
+  chain.retrieve(vec[0].iov_len - 100);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 1);
+
+  const string str = chain.retrieveAllAsString();
+  BOOST_CHECK_EQUAL(str.size(), 1500 - vec[0].iov_len);
+  BOOST_CHECK_EQUAL(str, string(str.size(), 'z'));
+  BOOST_CHECK(chain.empty());
+  BOOST_CHECK_EQUAL(chain.numChunks(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(testBufferChainLargeAppend)
+{
+  BufferChain chain;
+  const string big(3 * BufferChain::kMaxChunkSize, 'b');
+  chain.append(big);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 1);
+  BOOST_CHECK_EQUAL(chain.readableBytes(), big.size());
+  BOOST_CHECK_EQUAL(chain.retrieveAllAsString(), big);
+}
+
+BOOST_AUTO_TEST_CASE(testBufferChainLinkChunk)
+{
+  BufferChain chain;
+  chain.append("hello ", 6);
+
+  BufferPtr chunk(new Buffer);
+  chunk->append("world", 5);
+  chain.append(chunk);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 2);
+
+  // never writes into a linked chunk
+  chain.append("!", 1);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 3);
+  BOOST_CHECK_EQUAL(chunk->readableBytes(), 5);
+  BOOST_CHECK_EQUAL(chain.retrieveAllAsString(), string("hello world!"));
+}
+
+BOOST_AUTO_TEST_CASE(testBufferChainWriteFd)
+{
+  int fds[2];
+  BOOST_REQUIRE_EQUAL(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+  BufferChain chain;
+  chain.append(string(100, 'a'));
+  chain.append(string(2000, 'b'));
+  chain.append(string(5000, 'c'));
+  BOOST_CHECK_EQUAL(chain.numChunks(), 3);
+
+  int savedErrno = 0;
+  ssize_t n = chain.writeFd(fds[0], &savedErrno);
+  BOOST_CHECK_EQUAL(n, 7100);
+  BOOST_CHECK(chain.empty());
+
+  char buf[8192];
+  ssize_t nr = ::read(fds[1], buf, sizeof buf);
+  BOOST_CHECK_EQUAL(nr, 7100);
+  BOOST_CHECK_EQUAL(string(buf, 100), string(100, 'a'));
+  BOOST_CHECK_EQUAL(string(buf + 7100 - 5000, 5000), string(5000, 'c'));
+
+  ::close(fds[0]);
+  ::close(fds[1]);
+}
+
+BOOST_AUTO_TEST_CASE(testBufferChainFileRegion)
+{
+  char path[] = "/tmp/bufferchain_unittest_XXXXXX";
+  int filefd = ::mkstemp(path);
+  BOOST_REQUIRE(filefd >= 0);
+  ::unlink(path);
+  const string content(10000, 'f');
+  BOOST_REQUIRE_EQUAL(::write(filefd, content.data(), content.size()), 10000);
+
+  BufferChain chain;
+  chain.append("head", 4);
+  chain.append(FileRegionPtr(new FileRegion(filefd, 100, 5000)));
+  ::close(filefd);  // FileRegion owns a dup
+  chain.append("tail", 4);
+  BOOST_CHECK_EQUAL(chain.numChunks(), 3);
+  BOOST_CHECK_EQUAL(chain.readableBytes(), 5008);
+
+  struct iovec vec[BufferChain::kMaxIovecs];
+  BOOST_CHECK_EQUAL(chain.peekIovec(vec, BufferChain::kMaxIovecs), 1);
+
+  int fds[2];
+  BOOST_REQUIRE_EQUAL(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  int savedErrno = 0;
+  BOOST_CHECK_EQUAL(chain.writeFd(fds[0], &savedErrno), 4);
+  BOOST_CHECK_EQUAL(chain.writeFd(fds[0], &savedErrno), 5000);
+  BOOST_CHECK_EQUAL(chain.writeFd(fds[0], &savedErrno), 4);
+  BOOST_CHECK(chain.empty());
+
+  char buf[8192];
+  ssize_t nr = ::read(fds[1], buf, sizeof buf);
+  BOOST_CHECK_EQUAL(nr, 5008);
+  BOOST_CHECK_EQUAL(string(buf, nr), "head" + string(5000, 'f') + "tail");
+
+  ::close(fds[0]);
+  ::close(fds[1]);
+}
@@ -0,0 +1,102 @@
+#include "muduo/net/BufferPool.h"
+
+//#define BOOST_TEST_MODULE BufferPoolTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <utility>
+
+using muduo::string;
+using muduo::net::Buffer;
+using muduo::net::BufferChain;
+using muduo::net::BufferPool;
+using muduo::net::BufferPtr;
+
+BOOST_AUTO_TEST_CASE(testBufferPoolGetPut)
+{
+  BufferPool pool;
+  BufferPtr buf = pool.get(100);
+  BOOST_CHECK_EQUAL(pool.misses(), 1);
+  BOOST_CHECK_EQUAL(buf->writableBytes(), BufferPool::kMinSize);
+  buf->append(string(100, 'x'));
+  const char* storage = buf->peek();
+
+  pool.put(std::move(buf));
+  BOOST_CHECK_EQUAL(pool.recycled(), 1);
+  BOOST_CHECK(pool.cachedBytes() > 0);
+
+  BufferPtr buf2 = pool.get(1000);
+  BOOST_CHECK_EQUAL(pool.hits(), 1);
+  BOOST_CHECK_EQUAL(buf2->readableBytes(), 0);
+  BOOST_CHECK_EQUAL(buf2->peek(), storage);
+  BOOST_CHECK_EQUAL(pool.cachedBytes(), 0);
+
+  // different size class
+  BufferPtr buf3 = pool.get(5000);
+  BOOST_CHECK_EQUAL(pool.misses(), 2);
+  BOOST_CHECK_EQUAL(buf3->writableBytes(), 8192);
+}
+
+BOOST_AUTO_TEST_CASE(testBufferPoolAcquireRelease)
+{
+  BufferPool pool;
+  Buffer buf(0);
+  BOOST_CHECK_EQUAL(buf.writableBytes(), 0);
+
+  pool.acquire(&buf, Buffer::kInitialSize);
+  BOOST_CHECK_EQUAL(buf.writableBytes(), Buffer::kInitialSize);
+  buf.append("hello", 5);
+  buf.retrieveAll();
+
+  pool.release(&buf);
+  BOOST_CHECK_EQUAL(buf.writableBytes(), 0);
+  BOOST_CHECK_EQUAL(buf.readableBytes(), 0);
+  BOOST_CHECK_EQUAL(buf.prependableBytes(), Buffer::kCheapPrepend);
+  BOOST_CHECK_EQUAL(pool.recycled(), 1);
+
+  pool.acquire(&buf, Buffer::kInitialSize);
+  BOOST_CHECK_EQUAL(pool.hits(), 1);
+  BOOST_CHECK_EQUAL(buf.writableBytes(), Buffer::kInitialSize);
+
+  // a released buffer is still usable without pool
+  pool.release(&buf);
+  buf.append(string(3000, 'y'));
+  BOOST_CHECK_EQUAL(buf.retrieveAllAsString(), string(3000, 'y'));
+}
+
+BOOST_AUTO_TEST_CASE(testBufferPoolMaxCachedBytes)
+{
+  BufferPool pool;
+  pool.setMaxCachedBytes(3 * 1024);
+  BufferPtr a = pool.get(1024);
+  BufferPtr b = pool.get(2048);
+  BufferPtr c = pool.get(1024);
+  pool.put(std::move(a));
+  pool.put(std::move(b));
+  pool.put(std::move(c));
+  // b does not fit after a, c does
+  BOOST_CHECK_EQUAL(pool.recycled(), 2);
+  BOOST_CHECK_EQUAL(pool.dropped(), 1);
+  BOOST_CHECK(pool.cachedBytes() <= 3 * 1024);
+}
+
+BOOST_AUTO_TEST_CASE(testBufferChainWithPool)
+{
+  BufferPool pool;
+  {
+    BufferChain chain;
+    chain.setBufferPool(&pool);
+    chain.append(string(500, 'a'));
+    chain.append(string(2000, 'b'));
+    BOOST_CHECK_EQUAL(chain.numChunks(), 2);
+    BOOST_CHECK_EQUAL(pool.misses(), 2);
+    chain.retrieve(chain.readableBytes());
+    BOOST_CHECK_EQUAL(pool.recycled(), 2);
+
+    chain.append(string(500, 'c'));
+    BOOST_CHECK_EQUAL(pool.hits(), 1);
+    BOOST_CHECK_EQUAL(chain.retrieveAllAsString(), string(500, 'c'));
+    BOOST_CHECK_EQUAL(pool.recycled(), 3);
+  }
+}
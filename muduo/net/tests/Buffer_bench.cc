@@ -0,0 +1,129 @@
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/Buffer.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace muduo;
+using namespace muduo::net;
+
+// Bytes per cycle of Buffer::findCRLF() and findDelimiter() kernels,
+// delimiter at the very end of a readable region of each size.
+// Usage: buffer_bench [total_mb]
+
+namespace
+{
+
+typedef const char* (*Finder)(const char*, const char*, const char*, size_t);
+
+const char* findStdSearch(const char* begin, const char* end,
+                          const char* delim, size_t delimLen)
+{
+  // what findCRLF() used to do
+  const char* found = std::search(begin, end, delim, delim + delimLen);
+  return found == end ? NULL : found;
+}
+
+const char* findMemmem(const char* begin, const char* end,
+                       const char* delim, size_t delimLen)
+{
+  return static_cast<const char*>(::memmem(begin, end - begin, delim, delimLen));
+}
+
+template<search::Kernel kKernel>
+const char* findKernel(const char* begin, const char* end,
+                       const char* delim, size_t delimLen)
+{
+  return search::findWith(kKernel, begin, end, delim, delimLen);
+}
+
+uint64_t cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return Timestamp::now().microSecondsSinceEpoch() * 1000;  // ns
+#endif
+}
+
+double bench(Finder finder, const Buffer& buf, const string& delim, int rounds)
+{
+  const char* expected = buf.beginWrite() - delim.size();
+  uint64_t start = cycles();
+  for (int i = 0; i < rounds; ++i)
+  {
+    const char* found = finder(buf.peek(), buf.beginWrite(), delim.data(), delim.size());
+    if (found != expected)
+    {
+      fprintf(stderr, "wrong result\n");
+      abort();
+    }
+  }
+  uint64_t elapsed = cycles() - start;
+  return static_cast<double>(buf.readableBytes()) * rounds / static_cast<double>(elapsed);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  const double totalBytes = (argc > 1 ? atof(argv[1]) : 256) * 1024 * 1024;
+  const struct
+  {
+    const char* name;
+    Finder finder;
+  } finders[] = {
+    { "std::search", findStdSearch },
+    { "memmem", findMemmem },
+    { "scalar", findKernel<search::kScalar> },
+    { "sse2", findKernel<search::kSse2> },
+    { "avx2", findKernel<search::kAvx2> },
+  };
+  const size_t sizes[] = { 64, 256, 1024, 4096, 16384, 65536, 1024 * 1024 };
+  const string delims[] = { "\r\n", "\r\n\r\n" };
+
+  printf("best kernel %s, bytes per %s\n",
+         search::kernelName(search::bestKernel()),
+#if defined(__x86_64__) || defined(__i386__)
+         "TSC cycle"
+#else
+         "ns"
+#endif
+         );
+  srand(42);
+  for (const string& delim : delims)
+  {
+    printf("\ndelimiter %s\n%8s", delim.size() == 2 ? "CRLF" : "CRLFCRLF", "size");
+    for (const auto& f : finders)
+    {
+      printf(" %12s", f.name);
+    }
+    printf("\n");
+    for (size_t size : sizes)
+    {
+      // header-like text, a lone '\r' now and then
+      Buffer buf;
+      for (size_t i = 0; i + delim.size() < size; ++i)
+      {
+        char c = static_cast<char>('a' + rand() % 26);
+        buf.append(rand() % 64 == 0 ? "\r" : &c, 1);
+      }
+      buf.append(delim);
+      const int rounds = std::max(1, static_cast<int>(totalBytes / static_cast<double>(size)));
+      printf("%8zd", size);
+      for (const auto& f : finders)
+      {
+        printf(" %12.2f", bench(f.finder, buf, delim, rounds));
+      }
+      printf("\n");
+    }
+  }
+}
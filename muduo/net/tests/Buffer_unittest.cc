@@ -152,6 +152,58 @@ BOOST_AUTO_TEST_CASE(testBufferFindEOL)
   BOOST_CHECK_EQUAL(buf.findEOL(buf.peek()+90000), null);
 }
 
+BOOST_AUTO_TEST_CASE(testBufferFindCRLF)
+{
+  Buffer buf;
+  const char* null = NULL;
+  buf.append(string(1000, 'x'));
+  buf.append("\r\r\n");
+  BOOST_CHECK_EQUAL(buf.findCRLF(), buf.peek() + 1001);
+  BOOST_CHECK_EQUAL(buf.findCRLF(buf.peek() + 1002), null);
+  BOOST_CHECK_EQUAL(buf.findDelimiter("\r\r\n"), buf.peek() + 1000);
+  BOOST_CHECK_EQUAL(buf.findDelimiter("\r\n\r\n"), null);
+  BOOST_CHECK_EQUAL(buf.findDelimiter(""), buf.peek());
+  buf.retrieve(1002);
+  // shorter than the delimiter
+  BOOST_CHECK_EQUAL(buf.findDelimiter("\n\n"), null);
+}
+
+BOOST_AUTO_TEST_CASE(testSearchKernels)
+{
+  namespace search = muduo::net::search;
+  const search::Kernel kernels[] = { search::kScalar, search::kSse2, search::kAvx2 };
+  const string delims[] = { "\n", "\r\n", "\r\n\r\n", "END\r\n", string("a\0b", 3) };
+  // every length and position around vector widths, near misses before
+  for (const string& delim : delims)
+  {
+    for (size_t len = 0; len < 80; ++len)
+    {
+      for (size_t pos = 0; pos + delim.size() <= len; ++pos)
+      {
+        string text(len, 'x');
+        for (size_t i = 0; i + delim.size() < pos; i += 7)
+        {
+          text.replace(i, delim.size() - 1, delim, 0, delim.size() - 1);
+        }
+        text.replace(pos, delim.size(), delim);
+        const char* expected = text.data() + text.find(delim);
+        for (search::Kernel kernel : kernels)
+        {
+          BOOST_CHECK_EQUAL(search::findWith(kernel, text.data(), text.data() + len,
+                                             delim.data(), delim.size()),
+                            expected);
+        }
+      }
+      const string text(len, 'x');
+      for (search::Kernel kernel : kernels)
+      {
+        BOOST_CHECK(search::findWith(kernel, text.data(), text.data() + len,
+                                     delim.data(), delim.size()) == NULL);
+      }
+    }
+  }
+}
+
 void output(Buffer&& buf, const void* inner)
 {
   Buffer newbuf(std::move(buf));
@@ -1,7 +1,10 @@
 #include "muduo/net/EventLoopThreadPool.h"
 #include "muduo/net/EventLoop.h"
+#include "muduo/base/CountDownLatch.h"
 #include "muduo/base/Thread.h"
 
+#include <vector>
+
 #include <stdio.h>
 #include <unistd.h>
 
@@ -14,6 +17,10 @@ void print(EventLoop* p = NULL)
          getpid(), CurrentThread::tid(), p);
 }
 
+void noop()
+{
+}
+
 void init(EventLoop* p)
 {
   printf("init(): pid = %d, tid = %d, loop = %p\n",
@@ -63,6 +70,59 @@ int main()
     assert(nextLoop == model.getNextLoop());
   }
 
+  {
+    printf("Load balance:\n");
+    EventLoopThreadPool model(&loop, "balance");
+    model.setThreadNum(3);
+    model.start(init);
+    std::vector<EventLoop*> loops = model.getAllLoops();
+    loops[0]->addConnections(2);
+    loops[2]->addConnections(1);
+    model.setLoadBalance(EventLoopThreadPool::kLeastConnections);
+    assert(model.getNextLoop() == loops[1]);
+    loops[1]->addConnections(2);
+    assert(model.getNextLoop() == loops[2]);
+    model.setLoadBalance(EventLoopThreadPool::kPowerOfTwoChoices);
+    loops[2]->addConnections(5);
+    for (int i = 0; i < 100; ++i)
+    {
+      // the most loaded loop loses every comparison
+      assert(model.getNextLoop() != loops[2]);
+    }
+    loops[0]->addConnections(-2);
+    loops[1]->addConnections(-2);
+    loops[2]->addConnections(-6);
+
+    // back up queues of loops 0 and 1, behind a functor that blocks them
+    CountDownLatch blocked(2);
+    CountDownLatch release(1);
+    for (int i = 0; i < 2; ++i)
+    {
+      loops[i]->runInLoop([&] { blocked.countDown(); release.wait(); });
+    }
+    blocked.wait();
+    for (int i = 0; i < 3; ++i)
+    {
+      loops[0]->queueInLoop(noop);
+    }
+    loops[1]->queueInLoop(noop);
+    model.setLoadBalance(EventLoopThreadPool::kLeastQueueSize);
+    assert(model.getNextLoop() == loops[2]);
+    assert(model.getNextLoop() == loops[2]);
+    release.countDown();
+    while (loops[0]->queueSize() > 0 || loops[1]->queueSize() > 0)
+    {
+      ::usleep(1000);
+    }
+    // all empty, round-robin
+    EventLoop* first = model.getNextLoop();
+    EventLoop* second = model.getNextLoop();
+    EventLoop* third = model.getNextLoop();
+    assert(first != second && second != third && third != first);
+    assert(model.getNextLoop() == first);
+    (void)first; (void)second; (void)third;
+  }
+
   loop.loop();
 }
 
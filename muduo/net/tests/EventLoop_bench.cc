@@ -0,0 +1,68 @@
+#include "muduo/base/CountDownLatch.h"
+#include "muduo/base/Thread.h"
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/EventLoopThread.h"
+
+#include <memory>
+#include <vector>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+// Many threads post functors to one EventLoop, measures queueInLoop() throughput.
+
+int g_total = 0;
+int g_done = 0;
+EventLoop* g_loop = NULL;
+
+void onFunctor()
+{
+  if (++g_done == g_total)
+  {
+    g_loop->quit();
+  }
+}
+
+void produce(CountDownLatch* start, int times)
+{
+  start->wait();
+  for (int i = 0; i < times; ++i)
+  {
+    g_loop->queueInLoop(onFunctor);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  int numThreads = argc > 1 ? atoi(argv[1]) : 4;
+  int times = argc > 2 ? atoi(argv[2]) : 1000000;
+  g_total = numThreads * times;
+
+  EventLoop loop;
+  g_loop = &loop;
+
+  CountDownLatch start(1);
+  std::vector<std::unique_ptr<Thread>> threads;
+  for (int i = 0; i < numThreads; ++i)
+  {
+    threads.emplace_back(new Thread(std::bind(produce, &start, times)));
+    threads.back()->start();
+  }
+
+  Timestamp begin(Timestamp::now());
+  start.countDown();
+  loop.loop();
+  double seconds = timeDifference(Timestamp::now(), begin);
+
+  for (auto& thr : threads)
+  {
+    thr->join();
+  }
+  printf("%d threads, %d functors, %.3f seconds, %.0f functors/s, %" PRId64 " iterations\n",
+         numThreads, g_total, seconds, g_total / seconds, loop.iteration());
+}
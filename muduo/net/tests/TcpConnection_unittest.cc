@@ -0,0 +1,493 @@
+#include "muduo/net/TcpConnection.h"
+#include "muduo/base/Thread.h"
+#include "muduo/net/EventLoop.h"
+#include "muduo/net/TcpServer.h"
+
+//#define BOOST_TEST_MODULE TcpConnectionTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+using muduo::string;
+using muduo::StringPiece;
+using muduo::Timestamp;
+using muduo::net::Buffer;
+using muduo::net::EventLoop;
+using muduo::net::InetAddress;
+using muduo::net::TcpConnectionPtr;
+using muduo::net::TcpServer;
+
+namespace
+{
+
+int64_t g_writeCalls = -1;
+int64_t g_writesSaved = -1;
+
+void onConnection(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    conn->setCorking(true);
+  }
+}
+
+void recordAndQuit(const TcpConnectionPtr& conn)
+{
+  g_writeCalls = conn->writeCalls();
+  g_writesSaved = conn->writesSaved();
+  conn->getLoop()->quit();
+}
+
+void onMessage(const TcpConnectionPtr& conn, Buffer* buf, Timestamp)
+{
+  buf->retrieveAll();
+  conn->send("HTTP/1.1 200 OK\r\n");
+  conn->send(string("Content-Length: 5\r\n\r\n"));
+  conn->send("hello");
+  conn->shutdown();
+  // counters after the flush at end of this iteration, which was staged
+  // first, server goes away with conn still kDisconnecting
+  EventLoop* loop = conn->getLoop();
+  loop->runAfterIteration(loop->iteration(), std::bind(recordAndQuit, conn));
+}
+
+void echo(const TcpConnectionPtr& conn, Buffer* buf, Timestamp)
+{
+  conn->send(buf);
+}
+
+void quitOnClose(const TcpConnectionPtr& conn)
+{
+  if (conn->disconnected())
+  {
+    conn->getLoop()->quit();
+  }
+}
+
+string makePayload(size_t len)
+{
+  string payload(len, '\0');
+  for (size_t i = 0; i < len; ++i)
+  {
+    payload[i] = static_cast<char>('a' + i * 7 % 26);
+  }
+  return payload;
+}
+
+int connectTo(const InetAddress& addr)
+{
+  int sockfd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  struct timeval tv = { 5, 0 };
+  ::setsockopt(sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
+  ::setsockopt(sockfd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof tv);
+  BOOST_REQUIRE_EQUAL(::connect(sockfd, addr.getSockAddr(),
+                                sizeof(struct sockaddr_in)), 0);
+  return sockfd;
+}
+
+// reads nothing till all is written, so replies pile up in output buffer
+void writeThenRead(int sockfd, const string* data, string* received)
+{
+  size_t written = 0;
+  ssize_t n = 0;
+  while (written < data->size()
+         && (n = ::write(sockfd, data->data() + written, data->size() - written)) > 0)
+  {
+    written += n;
+  }
+  char buf[65536];
+  while (received->size() < data->size() && (n = ::read(sockfd, buf, sizeof buf)) > 0)
+  {
+    received->append(buf, n);
+  }
+  // server closes after our FIN
+  ::shutdown(sockfd, SHUT_WR);
+}
+
+// one letter per overload that left its argument empty, in order
+string g_sendLog;
+int64_t g_gatherWrites = -1;
+std::unique_ptr<muduo::Thread> g_sender;
+
+void check(bool ok, const char* what)
+{
+  g_sendLog += ok ? what : "?";
+}
+
+void sendAll(const TcpConnectionPtr& conn)
+{
+  string s("string,");
+  conn->send(std::move(s));
+  check(s.empty(), "s");
+
+  Buffer b;
+  b.append("buffer,");
+  conn->send(std::move(b));
+  check(b.readableBytes() == 0, "b");
+
+  std::vector<StringPiece> pieces;
+  pieces.push_back("gather");
+  pieces.push_back(",");
+  pieces.push_back("pieces,");
+  const int64_t writeCalls = conn->writeCalls();
+  conn->send(pieces);
+  if (conn->getLoop()->isInLoopThread())
+  {
+    g_gatherWrites = conn->writeCalls() - writeCalls;
+  }
+
+  Buffer p;
+  p.append("pointer");
+  conn->send(&p);
+  check(p.readableBytes() == 0, "p");
+
+  conn->shutdown();
+  // queued after the sends
+  conn->getLoop()->runInLoop(std::bind(&EventLoop::quit, conn->getLoop()));
+}
+
+void sendInLoop(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    sendAll(conn);
+  }
+}
+
+void sendFromThread(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    g_sender.reset(new muduo::Thread(std::bind(sendAll, conn), "sender"));
+    g_sender->start();
+  }
+}
+
+string readUntilEof(int sockfd)
+{
+  string received;
+  char buf[256];
+  ssize_t n = 0;
+  while ((n = ::read(sockfd, buf, sizeof buf)) > 0)
+  {
+    received.append(buf, n);
+  }
+  BOOST_CHECK_EQUAL(n, 0);
+  return received;
+}
+
+const size_t kZeroCopyThreshold = 16 * 1024;
+size_t g_zeroCopyInflight = 0;
+TcpConnectionPtr g_zeroCopyConn;
+
+void sendZeroCopy(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    conn->setZeroCopyThreshold(kZeroCopyThreshold);
+    Buffer payload;
+    payload.append(makePayload(4 * kZeroCopyThreshold));
+    conn->send(std::move(payload));
+    g_zeroCopyInflight = conn->outputBuffer()->zeroCopyInflight();
+    g_zeroCopyConn = conn;
+  }
+}
+
+// completion comes on error queue, as POLLERR
+void quitWhenReleased(EventLoop* loop)
+{
+  if (g_zeroCopyConn
+      && g_zeroCopyConn->outputBuffer()->empty()
+      && g_zeroCopyConn->outputBuffer()->zeroCopyInflight() == 0)
+  {
+    loop->quit();
+  }
+}
+
+void readN(int sockfd, size_t len, string* received)
+{
+  char buf[65536];
+  ssize_t n = 0;
+  while (received->size() < len && (n = ::read(sockfd, buf, sizeof buf)) > 0)
+  {
+    received->append(buf, n);
+  }
+}
+
+TcpConnectionPtr g_idleConn;
+
+void keepIdle(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    conn->setIdleBufferRelease(100);
+    g_idleConn = conn;
+  }
+}
+
+void discard(const TcpConnectionPtr&, Buffer* buf, Timestamp)
+{
+  buf->retrieveAll();
+}
+
+// corked on an edge-triggered socket, more than one writev() can take
+const int kCorkedChunks = 100;
+int g_corkedFile = -1;
+bool g_edgeTriggered = false;
+
+void corkOrQuit(const TcpConnectionPtr& conn)
+{
+  if (conn->connected())
+  {
+    g_edgeTriggered = conn->isEdgeTriggered();
+    conn->setCorking(true);
+  }
+  else
+  {
+    conn->getLoop()->quit();
+  }
+}
+
+// sends on request, after the first writable edge of a new socket is gone
+void sendCorked(const TcpConnectionPtr& conn, Buffer* buf, Timestamp)
+{
+  buf->retrieveAll();
+  if (g_corkedFile >= 0)
+  {
+    conn->send("header,");
+    conn->sendFile(g_corkedFile, 0, 8192);
+  }
+  else
+  {
+    for (int i = 0; i < kCorkedChunks; ++i)
+    {
+      Buffer chunk;
+      chunk.append("chunk,");
+      conn->send(std::move(chunk));
+    }
+  }
+  conn->shutdown();
+}
+
+void requestThenRead(int sockfd, string* received)
+{
+  BOOST_CHECK_EQUAL(::write(sockfd, "go", 2), 2);
+  *received = readUntilEof(sockfd);
+  ::close(sockfd);
+}
+
+string runCorkedEdgeTriggered(uint16_t port)
+{
+  EventLoop loop;
+  const InetAddress listenAddr(port, true);
+  TcpServer server(&loop, listenAddr, "CorkedEdgeServer");
+  server.setEdgeTriggered(true);
+  server.setConnectionCallback(corkOrQuit);
+  server.setMessageCallback(sendCorked);
+  server.start();
+  loop.runAfter(10.0, std::bind(&EventLoop::quit, &loop));
+
+  string received;
+  int client = connectTo(listenAddr);
+  muduo::Thread thread(std::bind(requestThenRead, client, &received), "client");
+  thread.start();
+  loop.loop();
+  thread.join();
+  BOOST_CHECK_EQUAL(g_edgeTriggered, loop.supportsEdgeTriggered());
+  return received;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(testIdleReleaseIgnoresSpins)
+{
+  EventLoop loop;
+  // spins all along, each an iteration without events
+  loop.setBusyPoll(1000 * 1000);
+  const InetAddress listenAddr(29522, true);
+  TcpServer server(&loop, listenAddr, "IdleServer");
+  server.setConnectionCallback(keepIdle);
+  server.setMessageCallback(discard);
+  server.start();
+  loop.runAfter(0.05, std::bind(&EventLoop::quit, &loop));
+
+  int client = connectTo(listenAddr);
+  BOOST_REQUIRE_EQUAL(::write(client, "x", 1), 1);
+  loop.loop();
+  TcpConnectionPtr conn;
+  conn.swap(g_idleConn);
+
+  BOOST_REQUIRE(conn);
+  BOOST_CHECK_EQUAL(conn->bytesReceived(), 1);
+  BOOST_CHECK_GT(loop.spinPolls(), 100);
+  // a handful of iterations with events since, storage is kept
+  BOOST_CHECK_GT(conn->inputBuffer()->writableBytes(), 0u);
+  ::close(client);
+}
+
+BOOST_AUTO_TEST_CASE(testZeroCopySend)
+{
+  EventLoop loop;
+  const InetAddress listenAddr(29521, true);
+  TcpServer server(&loop, listenAddr, "ZeroCopyServer");
+  server.setConnectionCallback(sendZeroCopy);
+  server.start();
+  loop.runEvery(0.001, std::bind(quitWhenReleased, &loop));
+  loop.runAfter(5.0, std::bind(&EventLoop::quit, &loop));
+
+  const string payload = makePayload(4 * kZeroCopyThreshold);
+  string received;
+  int client = connectTo(listenAddr);
+  muduo::Thread reader(std::bind(readN, client, payload.size(), &received), "reader");
+  reader.start();
+  loop.loop();
+  reader.join();
+  ::close(client);
+  TcpConnectionPtr conn;
+  conn.swap(g_zeroCopyConn);
+
+  // chunk was pinned till kernel reported completion, then released
+  BOOST_CHECK_GE(g_zeroCopyInflight, 1u);
+  BOOST_REQUIRE(conn);
+  BOOST_CHECK_EQUAL(conn->outputBuffer()->zeroCopyInflight(), 0u);
+  BOOST_CHECK(received == payload);
+}
+
+BOOST_AUTO_TEST_CASE(testSendOverloadsInLoop)
+{
+  EventLoop loop;
+  const InetAddress listenAddr(29520, true);
+  TcpServer server(&loop, listenAddr, "SendServer");
+  server.setConnectionCallback(sendInLoop);
+  server.start();
+  loop.runAfter(5.0, std::bind(&EventLoop::quit, &loop));
+
+  g_sendLog.clear();
+  g_gatherWrites = -1;
+  int client = connectTo(listenAddr);
+  loop.loop();
+
+  BOOST_CHECK_EQUAL(g_sendLog, "sbp");
+  // three pieces, one writev(2)
+  BOOST_CHECK_EQUAL(g_gatherWrites, 1);
+  BOOST_CHECK_EQUAL(readUntilEof(client), "string,buffer,gather,pieces,pointer");
+  ::close(client);
+}
+
+BOOST_AUTO_TEST_CASE(testSendOverloadsFromThread)
+{
+  EventLoop loop;
+  const InetAddress listenAddr(29520, true);
+  TcpServer server(&loop, listenAddr, "SendServer");
+  server.setConnectionCallback(sendFromThread);
+  server.start();
+  loop.runAfter(5.0, std::bind(&EventLoop::quit, &loop));
+
+  g_sendLog.clear();
+  int client = connectTo(listenAddr);
+  loop.loop();
+  g_sender->join();
+  g_sender.reset();
+
+  BOOST_CHECK_EQUAL(g_sendLog, "sbp");
+  BOOST_CHECK_EQUAL(readUntilEof(client), "string,buffer,gather,pieces,pointer");
+  ::close(client);
+}
+
+BOOST_AUTO_TEST_CASE(testCorkingCoalescesSends)
+{
+  EventLoop loop;
+  const InetAddress listenAddr(29517, true);
+  TcpServer server(&loop, listenAddr, "CorkServer");
+  server.setConnectionCallback(onConnection);
+  server.setMessageCallback(onMessage);
+  server.start();
+  loop.runAfter(5.0, std::bind(&EventLoop::quit, &loop));
+
+  // connect() completes in the backlog, before the loop runs
+  int client = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  struct timeval tv = { 1, 0 };
+  ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
+  BOOST_REQUIRE_EQUAL(::connect(client, listenAddr.getSockAddr(),
+                                sizeof(struct sockaddr_in)), 0);
+  BOOST_REQUIRE_EQUAL(::write(client, "GET / HTTP/1.1\r\n\r\n", 18), 18);
+  loop.loop();
+
+  BOOST_CHECK_EQUAL(g_writeCalls, 1);
+  BOOST_CHECK_EQUAL(g_writesSaved, 2);
+
+  // all three pieces arrive, then FIN from shutdown() after the flush
+  string received;
+  char buf[256];
+  ssize_t n = 0;
+  while ((n = ::read(client, buf, sizeof buf)) > 0)
+  {
+    received.append(buf, n);
+  }
+  BOOST_CHECK_EQUAL(n, 0);
+  BOOST_CHECK_EQUAL(received, "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello");
+  ::close(client);
+}
+
+BOOST_AUTO_TEST_CASE(testCorkedEdgeTriggeredManyChunks)
+{
+  // more chunks than one writev() takes, and no EAGAIN to arm the edge
+  string expected;
+  for (int i = 0; i < kCorkedChunks; ++i)
+  {
+    expected += "chunk,";
+  }
+  BOOST_CHECK_EQUAL(runCorkedEdgeTriggered(29523), expected);
+}
+
+BOOST_AUTO_TEST_CASE(testCorkedEdgeTriggeredChunkThenFile)
+{
+  // writev() stops at the file region
+  char path[] = "/tmp/muduo_corked_XXXXXX";
+  g_corkedFile = ::mkstemp(path);
+  BOOST_REQUIRE(g_corkedFile >= 0);
+  ::unlink(path);
+  const string content = makePayload(8192);
+  BOOST_REQUIRE_EQUAL(::write(g_corkedFile, content.data(), content.size()),
+                      static_cast<ssize_t>(content.size()));
+  const string received = runCorkedEdgeTriggered(29524);
+  ::close(g_corkedFile);
+  g_corkedFile = -1;
+  BOOST_CHECK(received == "header," + content);
+}
+
+// many reads and writes that don't fit socket buffers, also run with
+// MUDUO_USE_IO_URING=1, where the poller does them with its own buffers
+BOOST_AUTO_TEST_CASE(testEchoLargePayload)
+{
+  EventLoop loop;
+  const InetAddress listenAddr(29519, true);
+  TcpServer server(&loop, listenAddr, "EchoServer");
+  server.setConnectionCallback(quitOnClose);
+  server.setMessageCallback(echo);
+  server.start();
+  loop.runAfter(10.0, std::bind(&EventLoop::quit, &loop));
+
+  const string payload = makePayload(16 * 1024 * 1024);
+  string received;
+  int client = connectTo(listenAddr);
+  // so replies don't all fit in kernel buffers
+  int rcvbuf = 64 * 1024;
+  ::setsockopt(client, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof rcvbuf);
+  muduo::Thread thread(std::bind(writeThenRead, client, &payload, &received), "client");
+  thread.start();
+  loop.loop();
+  thread.join();
+  ::close(client);
+
+  BOOST_CHECK_EQUAL(received.size(), payload.size());
+  BOOST_CHECK(received == payload);
+}
@@ -0,0 +1,90 @@
+#include "muduo/base/Timestamp.h"
+#include "muduo/net/EventLoop.h"
+
+#include <vector>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace muduo;
+using namespace muduo::net;
+
+// Compares set-based TimerQueue with TimingWheel through EventLoop::runAfter/cancel.
+// Usage: timerqueue_bench [num_timers] [num_fired]
+
+int g_fired = 0;
+int g_toFire = 0;
+EventLoop* g_loop = NULL;
+
+void onTimer()
+{
+}
+
+void onFired()
+{
+  if (++g_fired == g_toFire)
+  {
+    g_loop->quit();
+  }
+}
+
+void bench(const char* name, int numTimers, int numFired)
+{
+  EventLoop loop;
+  g_loop = &loop;
+  std::vector<TimerId> ids;
+  ids.reserve(numTimers);
+  srand(42);
+
+  // idle timeouts of many connections, 1 to 60 seconds
+  Timestamp start(Timestamp::now());
+  for (int i = 0; i < numTimers; ++i)
+  {
+    ids.push_back(loop.runAfter(1.0 + rand() % 59000 / 1000.0, onTimer));
+  }
+  double addSeconds = timeDifference(Timestamp::now(), start);
+
+  // every other connection becomes active and resets its timer
+  start = Timestamp::now();
+  for (int i = 0; i < numTimers; i += 2)
+  {
+    loop.cancel(ids[i]);
+    ids[i] = loop.runAfter(1.0 + rand() % 59000 / 1000.0, onTimer);
+  }
+  double resetSeconds = timeDifference(Timestamp::now(), start);
+
+  // short timers which do fire, within 100ms
+  g_fired = 0;
+  g_toFire = numFired;
+  start = Timestamp::now();
+  for (int i = 0; i < numFired; ++i)
+  {
+    loop.runAfter(rand() % 100000 / 1e6, onFired);
+  }
+  loop.loop();
+  double fireSeconds = timeDifference(Timestamp::now(), start);
+
+  start = Timestamp::now();
+  for (const TimerId& id : ids)
+  {
+    loop.cancel(id);
+  }
+  double cancelSeconds = timeDifference(Timestamp::now(), start);
+
+  printf("%-6s %d timers: add %.0f/s, reset %.0f/s, cancel %.0f/s; "
+         "%d fired in %.3f seconds, %" PRId64 " iterations\n",
+         name, numTimers, numTimers / addSeconds, numTimers / 2 / resetSeconds,
+         numTimers / cancelSeconds, numFired, fireSeconds, loop.iteration());
+}
+
+int main(int argc, char* argv[])
+{
+  int numTimers = argc > 1 ? atoi(argv[1]) : 500000;
+  int numFired = argc > 2 ? atoi(argv[2]) : 100000;
+
+  ::unsetenv("MUDUO_USE_TIMING_WHEEL");
+  bench("set", numTimers, numFired);
+  ::setenv("MUDUO_USE_TIMING_WHEEL", "1", 1);
+  bench("wheel", numTimers, numFired);
+}
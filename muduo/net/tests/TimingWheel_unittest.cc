@@ -0,0 +1,157 @@
+#include "muduo/net/TimingWheel.h"
+#include "muduo/net/Timer.h"
+
+//#define BOOST_TEST_MODULE TimingWheelTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using muduo::Timestamp;
+using muduo::net::Timer;
+using muduo::net::TimingWheel;
+
+namespace
+{
+
+const int64_t kBase = 1500000000LL * Timestamp::kMicroSecondsPerSecond;
+
+void noop()
+{
+}
+
+Timestamp at(int64_t us)
+{
+  return Timestamp(kBase + us);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(testTimingWheelExpireInOrder)
+{
+  TimingWheel wheel(at(0));
+  BOOST_CHECK(!wheel.nextEventTime().valid());
+
+  // level 0, 1, 2, 3 and one parked beyond the last level
+  const int64_t delays[] = { 1500, 300, 70 * 1000, 5 * 1000 * 1000,
+                             300LL * 1000 * 1000, 20LL * 86400 * 1000 * 1000, 300 };
+  const int kNumTimers = sizeof delays / sizeof delays[0];
+  for (int i = 0; i < kNumTimers; ++i)
+  {
+    wheel.insert(new Timer(noop, at(delays[i]), 0.0));
+  }
+  BOOST_CHECK_EQUAL(wheel.size(), kNumTimers);
+  BOOST_CHECK(wheel.nextEventTime().valid());
+
+  std::vector<Timer*> expired;
+  wheel.advance(at(200), &expired);
+  BOOST_CHECK(expired.empty());
+
+  wheel.advance(at(1000), &expired);
+  BOOST_REQUIRE_EQUAL(expired.size(), 2);
+  BOOST_CHECK(expired[0]->expiration() == at(300));
+  BOOST_CHECK(expired[1]->expiration() == at(300));
+  BOOST_CHECK_LT(expired[0]->sequence(), expired[1]->sequence());
+
+  // every timer fires, never before its expiration, in order
+  Timestamp last = at(300);
+  int64_t step = 700;
+  for (int64_t now = 1000; wheel.size() > 0; now += step, step *= 2)
+  {
+    size_t n = expired.size();
+    wheel.advance(at(now), &expired);
+    for (size_t i = n; i < expired.size(); ++i)
+    {
+      BOOST_CHECK(!(at(now) < expired[i]->expiration()));
+      BOOST_CHECK(!(expired[i]->expiration() < last));
+      last = expired[i]->expiration();
+    }
+  }
+  BOOST_CHECK_EQUAL(expired.size(), kNumTimers);
+  BOOST_CHECK(!wheel.nextEventTime().valid());
+  for (Timer* timer : expired)
+  {
+    delete timer;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testTimingWheelExactTick)
+{
+  TimingWheel wheel(at(0));
+  // cascaded from level 1 and 2 right into the tick it expires
+  Timer* t1 = new Timer(noop, at(64 * 1000), 0.0);
+  Timer* t2 = new Timer(noop, at(4096 * 1000), 0.0);
+  wheel.insert(t1);
+  wheel.insert(t2);
+
+  std::vector<Timer*> expired;
+  wheel.advance(at(64 * 1000 - 1), &expired);
+  BOOST_CHECK(expired.empty());
+  wheel.advance(at(64 * 1000), &expired);
+  BOOST_REQUIRE_EQUAL(expired.size(), 1);
+  BOOST_CHECK_EQUAL(expired[0], t1);
+  wheel.advance(at(4096 * 1000 - 1), &expired);
+  BOOST_CHECK_EQUAL(expired.size(), 1);
+  wheel.advance(at(4096 * 1000), &expired);
+  BOOST_REQUIRE_EQUAL(expired.size(), 2);
+  BOOST_CHECK_EQUAL(expired[1], t2);
+  delete t1;
+  delete t2;
+}
+
+BOOST_AUTO_TEST_CASE(testTimingWheelRemove)
+{
+  TimingWheel wheel(at(0));
+  Timer* t1 = new Timer(noop, at(10 * 1000), 0.0);
+  Timer* t2 = new Timer(noop, at(10 * 1000), 0.0);
+  Timer* t3 = new Timer(noop, at(100 * 1000), 0.0);
+  wheel.insert(t1);
+  wheel.insert(t2);
+  wheel.insert(t3);
+  const Timestamp next = wheel.nextEventTime();
+
+  BOOST_CHECK(wheel.remove(t1, t1->sequence()));
+  BOOST_CHECK(!wheel.remove(t1, t1->sequence()));
+  BOOST_CHECK(!wheel.remove(t2, t2->sequence() + 1));  // stale TimerId
+  BOOST_CHECK_EQUAL(wheel.size(), 2);
+  BOOST_CHECK(wheel.nextEventTime() == next);
+  delete t1;
+
+  BOOST_CHECK(wheel.remove(t2, t2->sequence()));
+  BOOST_CHECK(next < wheel.nextEventTime());
+  delete t2;
+
+  std::vector<Timer*> expired;
+  wheel.advance(at(100 * 1000), &expired);
+  BOOST_REQUIRE_EQUAL(expired.size(), 1);
+  BOOST_CHECK_EQUAL(expired[0], t3);
+  BOOST_CHECK(!wheel.remove(t3, t3->sequence()));
+  delete t3;
+
+  // timers left are deleted by the wheel
+  wheel.insert(new Timer(noop, at(200 * 1000), 0.0));
+}
+
+BOOST_AUTO_TEST_CASE(testTimingWheelRecycledTimer)
+{
+  // TimerQueue recycles timers, a stale TimerId finds a newer sequence
+  TimingWheel wheel(at(0));
+  Timer* timer = new Timer(noop, at(10 * 1000), 0.0);
+  const int64_t oldSequence = timer->sequence();
+  wheel.insert(timer);
+  BOOST_CHECK(wheel.remove(timer, oldSequence));
+  timer->retire();
+  BOOST_CHECK(!wheel.remove(timer, oldSequence));
+  BOOST_CHECK(!wheel.remove(timer, 0));
+
+  const int64_t newSequence = Timer::newSequence();
+  timer->reuse(noop, at(20 * 1000), 0.0, newSequence);
+  wheel.insert(timer);
+  BOOST_CHECK(!wheel.remove(timer, oldSequence));
+  BOOST_CHECK_EQUAL(wheel.size(), 1);
+  BOOST_CHECK(wheel.remove(timer, newSequence));
+  BOOST_CHECK_EQUAL(wheel.size(), 0);
+  BOOST_CHECK(!wheel.remove(NULL, 0));
+  delete timer;
+}
@@ -0,0 +1,122 @@
+#include "muduo/net/UdpSocket.h"
+#include "muduo/net/EventLoop.h"
+
+//#define BOOST_TEST_MODULE UdpSocketTest
+#define BOOST_TEST_MAIN
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+#include <stdio.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+using muduo::string;
+using muduo::Timestamp;
+using muduo::net::Datagram;
+using muduo::net::EventLoop;
+using muduo::net::InetAddress;
+using muduo::net::UdpSocket;
+
+namespace
+{
+
+int g_expected = 0;
+int g_received = 0;
+std::vector<int> g_batches;
+
+void onBatch(UdpSocket* socket, const Datagram* datagrams, int count, Timestamp)
+{
+  g_batches.push_back(count);
+  for (int i = 0; i < count; ++i)
+  {
+    string reply("echo ");
+    reply.append(datagrams[i].data, datagrams[i].length);
+    socket->sendTo(reply, datagrams[i].peer);
+  }
+  g_received += count;
+  if (g_received >= g_expected)
+  {
+    socket->getLoop()->quit();
+  }
+}
+
+int createClient()
+{
+  int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  struct timeval tv = { 1, 0 };
+  ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv);
+  return fd;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(testUdpSocketBatchEcho)
+{
+  EventLoop loop;
+  UdpSocket server(&loop, InetAddress(0, true), false);
+  server.setBatchCallback(onBatch);
+  server.start();
+  const InetAddress serverAddr = server.localAddress();
+  loop.runAfter(5.0, std::bind(&EventLoop::quit, &loop));
+
+  // queued before the loop runs, so they are read in batches
+  const int kDatagrams = 100;
+  g_expected = kDatagrams;
+  int client = createClient();
+  for (int i = 0; i < kDatagrams; ++i)
+  {
+    char buf[32];
+    int len = snprintf(buf, sizeof buf, "datagram %d", i);
+    BOOST_REQUIRE_EQUAL(::sendto(client, buf, len, 0, serverAddr.getSockAddr(),
+                                 sizeof(struct sockaddr_in)), len);
+  }
+  loop.loop();
+
+  BOOST_CHECK_EQUAL(g_received, kDatagrams);
+  BOOST_CHECK_EQUAL(server.datagramsReceived(), kDatagrams);
+  BOOST_CHECK_EQUAL(g_batches.front(), UdpSocket::kDefaultBatchSize);
+  BOOST_CHECK_EQUAL(server.recvCalls(), static_cast<int64_t>(g_batches.size()));
+  BOOST_CHECK_EQUAL(server.datagramsSent(), kDatagrams);
+  BOOST_CHECK_EQUAL(server.sendCalls(), static_cast<int64_t>(g_batches.size()));
+
+  for (int i = 0; i < kDatagrams; ++i)
+  {
+    char buf[64];
+    ssize_t n = ::recv(client, buf, sizeof buf, 0);
+    BOOST_REQUIRE_GT(n, 0);
+    char expected[32];
+    snprintf(expected, sizeof expected, "echo datagram %d", i);
+    BOOST_CHECK_EQUAL(string(buf, n), string(expected));
+  }
+  ::close(client);
+}
+
+BOOST_AUTO_TEST_CASE(testUdpSocketDropsTruncated)
+{
+  EventLoop loop;
+  UdpSocket server(&loop, InetAddress(0, true), false, 4, 16);
+  g_expected = 1;
+  g_received = 0;
+  g_batches.clear();
+  server.setBatchCallback(onBatch);
+  server.start();
+  const InetAddress serverAddr = server.localAddress();
+  loop.runAfter(5.0, std::bind(&EventLoop::quit, &loop));
+
+  int client = createClient();
+  const string large(32, 'x');
+  ::sendto(client, large.data(), large.size(), 0, serverAddr.getSockAddr(),
+           sizeof(struct sockaddr_in));
+  ::sendto(client, "small", 5, 0, serverAddr.getSockAddr(), sizeof(struct sockaddr_in));
+  loop.loop();
+
+  BOOST_CHECK_EQUAL(g_received, 1);
+  BOOST_CHECK_EQUAL(server.datagramsDropped(), 1);
+  char buf[64];
+  ssize_t n = ::recv(client, buf, sizeof buf, 0);
+  BOOST_CHECK_EQUAL(string(buf, n > 0 ? n : 0), "echo small");
+  ::close(client);
+}